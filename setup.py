@@ -29,7 +29,7 @@ import distutils.dir_util as dd
 # CMake function
 #################
 #def run_cmake(cmake_args="-DSIMX_USE_PRIME=1 -DSIMX_USE_MPI=1"):
-def run_cmake(use_prime=0,use_mpi=1):
+def run_cmake(use_prime=0,use_mpi=1,use_metis=0):
     """
     Runs CMake to determine configuration for this build
     """
@@ -44,7 +44,8 @@ def run_cmake(use_prime=0,use_mpi=1):
     os.chdir(new_dir)
     # construct argument string
     cmake_args ="-DSIMX_USE_PRIME="+str(use_prime) \
-        +" -DSIMX_USE_MPI="+str(use_mpi)
+        +" -DSIMX_USE_MPI="+str(use_mpi) \
+        +" -DSIMX_USE_METIS="+str(use_metis)
     try:
         ds.spawn(['cmake','../']+cmake_args.split())
     except ds.DistutilsExecError:
@@ -84,12 +85,16 @@ class  build(_build.build):
           "Uses the miniSSF synchronization engine instead of SimX's native engine for message passing and synchronization."),
          ('without-mpi',
           None,
-          "Build without MPI support. Parallel simulations are disabled in this case.")]
+          "Build without MPI support. Parallel simulations are disabled in this case."),
+         ('with-metis',
+          None,
+          "Builds in METIS, to place entities by partitioning an entity graph (see set_partition_graph).")]
 
     def initialize_options(self):
         _build.build.initialize_options(self)
         self.with_ssf = 0
         self.without_mpi = 0
+        self.with_metis = 0
         
     def run(self):
         cwd = os.getcwd()
@@ -98,7 +103,8 @@ class  build(_build.build):
         #     print "run setup.py build --help for options to build command"
         #     sys.exit(-1)
         run_cmake(use_prime=self.with_ssf,
-                  use_mpi = not self.without_mpi)
+                  use_mpi = not self.without_mpi,
+                  use_metis = self.with_metis)
         # if 
         # if self.without_ssf:
         #     run_cmake("-DSIMX_USE_PRIME=0")
@@ -106,6 +106,281 @@ def set_log_file( lf_name ):
     core.set_config_value("LOG_FILE", lf_name )
 
 
+def set_event_queue( queue_type ):
+    """
+
+    Sets the priority queue used by the simulation engine.
+    One of "multimap" (the default), "calendar" or "ladder".
+    Argument must be a string
+
+    """
+    core.set_config_value("EVENT_QUEUE", queue_type )
+
+
+def set_send_buffer_size( num_bytes ):
+    """
+
+    Sets the size (in bytes) at which the per-destination buffers of
+    events sent to other processes are sent out. They are always sent
+    out at the end of each synchronization window. The default is 65536.
+    Argument must be an integer
+
+    """
+    core.set_config_value("SEND_BUFFER_SIZE", str(num_bytes) )
+
+
+def set_shm_ring_size( num_bytes ):
+    """
+
+    Sets the size (in bytes) of the shared memory ring to each other
+    simulation process on the same machine. Events for those processes
+    go through the rings while there is room in them, and are sent with
+    MPI otherwise. The default is 1048576, 0 sends everything with MPI.
+    Argument must be an integer
+
+    """
+    core.set_config_value("SHM_RING_SIZE", str(num_bytes) )
+
+
+def set_sync_window( mode ):
+    """
+
+    Sets how parallel simulation processes pick the time windows
+    between synchronizations.
+    "fixed" (the default): windows are Look-Ahead (min_delay) wide.
+    "adaptive": each process works up to the earliest time the others
+    could send it anything, which skips and widens windows when possible.
+    Argument must be a string
+
+    """
+    core.set_config_value("SYNC_WINDOW", mode )
+
+
+def set_sync_mode( mode ):
+    """
+
+    Sets how parallel simulation processes are kept in sync.
+    "conservative" (the default): no process ever executes an event
+    before all events that could affect it.
+    "optimistic": processes run ahead and roll back the events that
+    turned out to be executed too early. Only entities whose services
+    save their state are run ahead (C++ services, see
+    Service::getStateSaving), the others wait as in the conservative mode.
+    Argument must be a string
+
+    """
+    core.set_config_value("SYNC_MODE", mode )
+
+
+def set_gvt_interval( num_events ):
+    """
+
+    Sets how many events each simulation process executes between
+    computations of the global virtual time in the optimistic mode
+    (the time before which nothing can be rolled back anymore, and the
+    output is written). The default is 1000.
+    Argument must be an integer
+
+    """
+    core.set_config_value("GVT_INTERVAL", str(num_events) )
+
+
+def set_threads_per_rank( num_threads ):
+    """
+
+    Sets the number of threads executing events in each simulation
+    process (default 1). The entities of the process are split among
+    them. Python entities are all executed by the main thread, so this
+    helps models with C++ entities. Not available in the optimistic
+    sync mode. With more than one thread, entities must all be created
+    before the simulation starts. Each entity draws from its own random
+    stream, so the results do not depend on the number of threads; only
+    output lines written at the same simulation time may come in a
+    different order.
+    Argument must be an integer
+
+    """
+    core.set_config_value("THREADS_PER_RANK", str(num_threads) )
+
+
+def set_placement_file( file_name ):
+    """
+
+    Sets the file with fixed placement of entities on simulation processes.
+    Each line holds an entity id and the process number, e.g. "(p 112) 3".
+    Entities not in the file are placed as usual.
+    Argument must be a string
+
+    """
+    core.set_config_value("PLACEMENT_FILE", file_name )
+
+
+def set_partition_graph( file_names ):
+    """
+
+    Sets the entity graph file(s) to partition (with METIS) at start-up,
+    to place the entities on simulation processes so that the traffic
+    between processes is low. Files written with set_traffic_graph_file
+    can be used, several file names are separated by spaces. SimX must
+    be built with METIS for this (setup.py build --with-metis).
+    Argument must be a string
+
+    """
+    core.set_config_value("PARTITION_GRAPH", file_names )
+
+
+def set_traffic_graph_file( file_name ):
+    """
+
+    Records the traffic between entities, and writes it at the end
+    of the simulation to this file (with the suffix of the process),
+    to be used with set_partition_graph in later runs.
+    Argument must be a string
+
+    """
+    core.set_config_value("TRAFFIC_GRAPH_FILE", file_name )
+
+
+def set_profile_file( file_name ):
+    """
+
+    Records how long the services take to receive the infos, per info
+    type and per service, and writes the totals of all simulation
+    processes at the end of the simulation to this file (count, total,
+    mean and percentiles of the time).
+    Argument must be a string
+
+    """
+    core.set_config_value("PROFILE_FILE", file_name )
+
+
+def set_trace_file( file_name ):
+    """
+
+    Records a timeline of the simulation engine: when each process and
+    thread was executing events, synchronizing, sending and receiving,
+    and writes it at the end to this file as a Chrome trace (to be opened
+    with chrome://tracing or Perfetto). Each process first writes its
+    part to file_name.<process>.bin, which the first process must be able
+    to read.
+    Argument must be a string
+
+    """
+    core.set_config_value("TRACE_FILE", file_name )
+
+
+def set_trace_sample( num_events ):
+    """
+
+    Sets every how many-th event execution is in the trace (see
+    set_trace_file). The default is 1000, 0 leaves events out.
+    Argument must be an integer
+
+    """
+    core.set_config_value("TRACE_SAMPLE", str(num_events) )
+
+
+def set_trace_buffer( num_spans ):
+    """
+
+    Sets how many trace records each thread keeps in memory before
+    writing them out (see set_trace_file). The default is 65536.
+    Argument must be an integer
+
+    """
+    core.set_config_value("TRACE_BUFFER", str(num_spans) )
+
+
+def set_load_file( file_name ):
+    """
+
+    Makes each simulation process write a line per synchronization
+    window to this file (with the suffix of the process): the time the
+    window started, the events executed, the time spent executing and
+    synchronizing (in microseconds), and the remote events sent and
+    received. The totals over all processes (minimum, mean, maximum)
+    are in the log in any case.
+    Argument must be a string
+
+    """
+    core.set_config_value("LOAD_FILE", file_name )
+
+
+def set_input_index( mode ):
+    """
+
+    "on": each simulation process reads only its own records from the
+    binary entity and info files (written by simx_convert_input), using
+    an index next to each file (file_name.idx). The first process writes
+    the indices when they are missing or do not fit the files, the
+    number of processes or the placement of the entities, so the first
+    run reads everything as usual. Entity files are read whole when
+    pre-creating functions are registered. The default is "off".
+    Argument must be a string
+
+    """
+    core.set_config_value("INPUT_INDEX", mode )
+
+
+def set_info_chunk_size( num_records ):
+    """
+
+    Sets about how many records of an info file are read at a time
+    (the infos for the next part of the simulation). The default is 10000.
+    Argument must be an integer
+
+    """
+    core.set_config_value("INFO_CHUNK_SIZE", str(num_records) )
+
+
+def set_info_prefetch( mode ):
+    """
+
+    "on": each info file is read ahead in a thread of its own while the
+    simulation runs, so that reading does not hold the simulation up.
+    The Infos are then created in those threads, which their readData
+    must allow (C++ Infos only, they must not use Python). The default
+    is "off".
+    Argument must be a string
+
+    """
+    core.set_config_value("INFO_PREFETCH", mode )
+
+
+def set_entity_threads( num_threads ):
+    """
+
+    Sets the number of threads reading the entities of the entity
+    files in each simulation process (default 1). The pre-creating and
+    placing functions still run in the main thread, in the order of the
+    files; the Inputs of the entities are made in all of them, which
+    their readData must allow: C++ only, it must not use Python or
+    anything shared, such as the random number generator. The entities
+    themselves are constructed by the main thread, unless
+    set_entity_parallel_create is "on". Python entities are always
+    created by the main thread. A pre-creating function still finds
+    all the entities before it, but a placing function may not: it
+    must not look up the entities.
+    Argument must be an integer
+
+    """
+    core.set_config_value("ENTITY_THREADS", str(num_threads) )
+
+
+def set_entity_parallel_create( mode ):
+    """
+
+    "on": with set_entity_threads above 1, the entities are also
+    constructed in those threads, not just read. Their constructors and
+    those of their services must then work in any thread: they must not
+    use Python, random streams other than the entity's own, the output
+    or the Infos of the simulation (InfoManager). The default is "off".
+    Argument must be a string
+
+    """
+    core.set_config_value("ENTITY_PARALLEL_CREATE", mode )
+
+
 def set_defaults( prog_name ):
     """
 
@@ -0,0 +1,395 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    BinaryInput.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Binary entity and info input files, read through mmap
+//     (written from the text files by simx_convert_input)
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_BINARYINPUT
+#define NISAC_SIMX_BINARYINPUT
+
+#include "simx/type.h"
+#include "simx/Input.h"
+#include "simx/Info.h"
+#include "simx/Entity.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <streambuf>
+#include <istream>
+
+namespace simx {
+
+/// Binary input files hold the same records as the text entity and info
+/// files, with the fixed fields stored as numbers, so that they can be
+/// used as they are. The custom data (the rest of a text line, read by
+/// Input::readData) is kept as text. Layout (native byte order):
+///
+///	BinaryInputHeader
+///	record, record, ...
+///	service address table (info files)
+///
+/// Each record is a BinaryEntityRecord or BinaryInfoRecord, followed by
+/// the entity type (entity files only) and the custom data, padded to
+/// 8 bytes. Service addresses are usually names the model registers
+/// (UserIO), so info records refer to an entry of the table, which
+/// holds the names as written in the text file ([uint16_t size][name]);
+/// they are looked up once, when the file is opened. Whether an input
+/// file is binary is decided by its first bytes (isBinaryInputFile()),
+/// so both kinds can be given in the config.
+
+/// what the file holds
+enum BinaryInputKind
+{
+    kBinaryEntityFile = 1,
+    kBinaryInfoFile = 2
+};
+
+struct BinaryInputHeader
+{
+    char	fMagic[8];	///< "SIMXBIN", zero terminated
+    uint32_t	fVersion;	///< of the format, reads wrong on other byte orders
+    uint32_t	fKind;		///< BinaryInputKind
+    uint64_t	fNumRecords;
+    uint64_t	fTableOffset;	///< of the service address table, 0 if none
+    uint32_t	fTableSize;	///< number of entries in it
+    uint32_t	fPad;
+};
+
+struct BinaryEntityRecord
+{
+    uint32_t	fSize;		///< of the whole record, with the padding
+    uint32_t	fDataSize;	///< of the custom data
+    int64_t	fEntityNumber;	///< second part of the EntityID
+    int32_t	fProfileId;
+    uint16_t	fTypeSize;	///< of the entity type
+    char	fEntityKind;	///< first part of the EntityID
+    char	fPad;
+};
+
+struct BinaryInfoRecord
+{
+    uint32_t	fSize;		///< of the whole record, with the padding
+    uint32_t	fDataSize;	///< of the custom data
+    int64_t	fTime;
+    int64_t	fEntityNumber;	///< second part of the EntityID
+    uint32_t	fAddressIndex;	///< in the service address table
+    int32_t	fInfoType;
+    int32_t	fProfileId;
+    char	fEntityKind;	///< first part of the EntityID
+    char	fPad[3];
+};
+
+/// does the file start with the binary input magic?
+bool isBinaryInputFile( const std::string& fileName );
+
+/// consecutive records of a binary input file (byte offsets in the file)
+struct BinaryInputRange
+{
+    uint64_t	fBegin;
+    uint64_t	fEnd;
+    uint64_t	fNumRecords;
+};
+
+/// \class MemoryStreamBuf BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief read-only streambuf over memory it does not own
+class MemoryStreamBuf : public std::streambuf
+{
+    public:
+	void reset( const char* data, size_t size )
+	{
+	    char* begin = const_cast<char*>( data );
+	    setg( begin, begin, begin + size );
+	}
+};
+
+/// \class MemoryInputStream BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief istream (Input::DataSource) over memory, can be pointed
+/// at a new range over and over without allocating anything
+class MemoryInputStream : public std::istream
+{
+    public:
+	MemoryInputStream()
+	    : std::istream( 0 )
+	{
+	    rdbuf( &fBuf );
+	}
+
+	void reset( const char* data, size_t size )
+	{
+	    fBuf.reset( data, size );
+	    clear();
+	}
+
+    private:
+	MemoryStreamBuf	fBuf;
+
+	/// unimplemented
+	MemoryInputStream(const MemoryInputStream&);
+	MemoryInputStream& operator=(const MemoryInputStream&);
+};
+
+/// \class MappedInputFile BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief a binary input file mapped into memory, and the position of
+/// the next record in it
+class MappedInputFile
+{
+    public:
+	/// maps the file and checks its header,
+	/// throws Common::Exception if it cannot be used as a file of this kind
+	MappedInputFile( const std::string& fileName, BinaryInputKind kind );
+	~MappedInputFile();
+
+	bool MoreData() const { return fRecordsLeft > 0; }
+
+	/// the next record, MoreData() must be true
+	const char* peek() const { return fNext; }
+
+	/// moves past the next record, checks it is all inside the file
+	const char* advance();
+
+	/// from now on, only the records in these ranges (sorted, not
+	/// overlapping) are read; must be called before reading anything
+	void restrict( const std::vector<BinaryInputRange>& ranges );
+
+	const std::string& getFileName() const { return fFileName; }
+	/// of the whole file
+	uint64_t getNumRecords() const { return fHeader->fNumRecords; }
+	/// where a record returned by advance() is in the file
+	uint64_t getOffset( const char* record ) const { return record - fData; }
+
+	/// the service address table, resolved to ServiceAddresses
+	/// (Logger::error for names that are neither registered nor numbers)
+	void readAddressTable( std::vector<ServiceAddress>& addresses ) const;
+
+    private:
+	std::string	fFileName;
+	char*		fData;		///< the mapping
+	size_t		fSize;
+	const char*	fNext;
+	const char*	fEnd;		///< of the records
+	const BinaryInputHeader* fHeader;
+	uint64_t	fRecordsLeft;
+	std::vector<BinaryInputRange> fRanges;	///< set by restrict()
+	size_t		fRange;		///< the one fNext is in
+	const char*	fRangeEnd;	///< of it
+
+	/// unimplemented
+	MappedInputFile(const MappedInputFile&);
+	MappedInputFile& operator=(const MappedInputFile&);
+};
+
+/// \class BinaryEntityReader BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief reads a binary entity file, the counterpart of EntityData::Reader
+///
+/// ReadData() decodes the next record into the reader itself (nothing is
+/// allocated once the type string has grown), the getters return it until
+/// the next ReadData()
+class BinaryEntityReader
+{
+    public:
+	BinaryEntityReader( const std::string& fileName );
+
+	bool MoreData() const { return fFile.MoreData(); }
+	/// reads only these records (see MappedInputFile::restrict())
+	void restrict( const std::vector<BinaryInputRange>& ranges ) { fFile.restrict( ranges ); }
+	/// of the whole file
+	uint64_t getNumRecords() const { return fFile.getNumRecords(); }
+	void ReadData();
+
+	/// where the record is in the file
+	const BinaryInputRange& getRecordRange() const { return fRecord; }
+	EntityID getEntityId() const { return fEntityId; }
+	const Entity::ClassType& getClassType() const { return fType; }
+	ProfileID getProfileId() const { return fProfileId; }
+	/// custom data of the record
+	Input::DataSource& getData() { return fData; }
+	/// the same as memory (in the mapped file, valid as long as the reader)
+	const char* getDataBegin() const { return fDataBegin; }
+	size_t getDataSize() const { return fDataSize; }
+
+    private:
+	MappedInputFile		fFile;
+	BinaryInputRange	fRecord;
+	EntityID		fEntityId;
+	Entity::ClassType	fType;
+	ProfileID		fProfileId;
+	const char*		fDataBegin;
+	size_t			fDataSize;
+	MemoryInputStream	fData;
+};
+
+/// \class BinaryInfoReader BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief reads a binary info file, the counterpart of InfoData::Reader
+///
+/// works like BinaryEntityReader
+class BinaryInfoReader
+{
+    public:
+	BinaryInfoReader( const std::string& fileName );
+
+	bool MoreData() const { return fFile.MoreData(); }
+	/// reads only these records (see MappedInputFile::restrict())
+	void restrict( const std::vector<BinaryInputRange>& ranges ) { fFile.restrict( ranges ); }
+	/// of the whole file
+	uint64_t getNumRecords() const { return fFile.getNumRecords(); }
+	/// time of the record the next ReadData() decodes, MoreData() must be true
+	Time getNextTime() const;
+	void ReadData();
+
+	/// where the record is in the file
+	const BinaryInputRange& getRecordRange() const { return fRecord; }
+	Time getTime() const { return fTime; }
+	EntityID getEntityId() const { return fEntityId; }
+	ServiceAddress getServiceAddress() const { return fServiceAddress; }
+	Info::ClassType getClassType() const { return fType; }
+	ProfileID getProfileId() const { return fProfileId; }
+	/// custom data of the record
+	Input::DataSource& getData() { return fData; }
+
+    private:
+	MappedInputFile		fFile;
+	std::vector<ServiceAddress> fAddresses;	///< the address table
+	BinaryInputRange	fRecord;
+	Time			fTime;
+	EntityID		fEntityId;
+	ServiceAddress		fServiceAddress;
+	Info::ClassType		fType;
+	ProfileID		fProfileId;
+	MemoryInputStream	fData;
+};
+
+/// \class BinaryInputIndex BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief which records of a binary input file go to which LP
+///
+/// With INPUT_INDEX on, each rank only reads the records of its own LPs
+/// from the binary input files that have an index (the file name + ".idx").
+/// An index is only good for the number of LPs and the exact data file
+/// (size and modification time) it was made for, otherwise it is made
+/// again. It also holds where the entities of the file (entity files) or
+/// the destinations of the infos (info files) were placed, and is made
+/// again when any of them is placed elsewhere now (a new placement file,
+/// partition or placing function). Entity file indices are not used when
+/// pre-creating functions are registered, as those run for every entity
+/// on every rank.
+///
+/// Layout (native byte order): BinaryIndexHeader, uint64_t first range
+/// of each LP (and the total), BinaryInputRange[], BinaryIndexPlacement[]
+class BinaryInputIndex
+{
+    public:
+	struct Placement
+	{
+	    int64_t	fEntityNumber;
+	    int32_t	fLpId;
+	    char	fEntityKind;
+	    char	fPad[3];
+	};
+
+	BinaryInputIndex();
+
+	/// is INPUT_INDEX on?
+	static bool isEnabled();
+	/// the index file of a data file
+	static std::string getIndexFileName( const std::string& dataFile );
+
+	/// reads the index of dataFile, returns false if there is none or
+	/// it does not fit dataFile (with numRecords records) and numLps
+	bool read( const std::string& dataFile, uint64_t numRecords, int numLps );
+
+	/// the ranges of the records for all the LPs (in the order of the file)
+	void getRanges( const std::vector<LPID>& lps, std::vector<BinaryInputRange>& ranges ) const;
+	/// the same for the LPs of this rank
+	void getLocalRanges( std::vector<BinaryInputRange>& ranges ) const;
+
+	/// the placement of all entities of an entity file, or of the
+	/// destinations of an info file
+	const std::vector<Placement>& getPlacements() const { return fPlacements; }
+
+	/// making an index: adds the next record of the file
+	void addRecord( const BinaryInputRange& record, LPID lpId );
+	/// making an index: where an entity of the file (or a destination) is placed
+	void addPlacement( const EntityID& id, LPID lpId );
+
+	/// writes the index of dataFile (under a temporary name, then renamed),
+	/// throws Common::Exception if it fails
+	void write( const std::string& dataFile, uint64_t numRecords, int numLps ) const;
+
+    private:
+	typedef std::vector<BinaryInputRange> RangeContainer;
+	std::vector<RangeContainer>	fRanges;	///< per LP
+	std::vector<Placement>		fPlacements;
+};
+
+/// \class BinaryInputWriter BinaryInput.h "simx/BinaryInput.h"
+///
+/// \brief writes binary input files (all records of one kind)
+class BinaryInputWriter
+{
+    public:
+	/// throws Common::Exception if the file cannot be created
+	BinaryInputWriter( const std::string& fileName, BinaryInputKind kind );
+	/// calls close()
+	~BinaryInputWriter();
+
+	void writeEntity( const EntityID&, const Entity::ClassType&, ProfileID, const std::string& data );
+	/// the service address is given as in the text file (a registered name or a number)
+	void writeInfo( Time, const EntityID&, const std::string& address, Info::ClassType,
+		ProfileID, const std::string& data );
+
+	/// writes the service address table and the final header,
+	/// throws Common::Exception if anything failed
+	void close();
+
+	uint64_t getNumRecords() const { return fNumRecords; }
+
+    private:
+	/// writes the fixed part of a record, then the strings, then the padding
+	void writeRecord( const char* fixed, size_t fixedSize,
+		const std::string& first, const std::string& second );
+
+	std::string	fFileName;
+	std::ofstream	fFile;
+	BinaryInputKind	fKind;
+	uint64_t	fNumRecords;
+	std::map<std::string, uint32_t> fAddressIndex;	///< service address table
+
+	/// unimplemented
+	BinaryInputWriter(const BinaryInputWriter&);
+	BinaryInputWriter& operator=(const BinaryInputWriter&);
+};
+
+} // namespace
+
+#endif
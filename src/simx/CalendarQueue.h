@@ -0,0 +1,100 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+
+//--------------------------------------------------------------------------
+// File:    CalendarQueue.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Calendar queue (R. Brown, CACM 1988) implementation of EventQueueImpl
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_CALENDARQUEUE
+#define NISAC_SIMX_CALENDARQUEUE
+
+#include "simx/EventQueue.h"
+
+#include <vector>
+
+namespace simx {
+
+/// Calendar queue: events are hashed by time into an array of "days" (buckets)
+/// of fixed width, each kept sorted; dequeueing walks the days of the current "year".
+/// The number of days is doubled/halved as the queue grows/shrinks, and the day
+/// width is re-estimated from the events at the front of the queue at that time.
+/// push and pop are O(1) on average for stationary time increment distributions.
+class CalendarQueue : public EventQueueImpl
+{
+    public:
+	CalendarQueue();
+	virtual ~CalendarQueue();
+
+	virtual bool empty() const;
+	virtual size_t size() const;
+	virtual EventQueueNode& top();
+	virtual void pop();
+	virtual void push( Time when, uint64_t seq, EventInfo& e );
+	virtual void clear();
+	virtual const char* getName() const;
+	virtual const EventQueueNodePool* getNodePool() const { return &fPool; }
+
+    private:
+	/// one day of the calendar, sorted list of events
+	struct Bucket
+	{
+	    EventQueueNode*	fHead;
+	    EventQueueNode*	fTail;	///< appending at the tail is the common case
+	};
+
+	/// puts the node to its bucket, keeping the bucket sorted
+	void insert( EventQueueNode* );
+	/// finds the smallest node (and sets fMin, fCurBucket and fCurTop)
+	EventQueueNode* findMin();
+	/// rehashes the events into a calendar with numBuckets days
+	void resize( size_t numBuckets );
+	/// day width estimated from the (sorted) events
+	Time estimateWidth( const std::vector<EventQueueNode*>& ) const;
+
+	/// the number of the day (counted from time 0) that t falls into
+	Time virtualBucket( Time t ) const;
+	size_t bucketIndex( Time t ) const;
+	/// makes the day containing t the current one
+	void setCurrent( Time t );
+
+	static const size_t kMinBuckets = 16;
+
+	std::vector<Bucket>	fBuckets;
+	size_t			fMask;		///< fBuckets.size()-1 (size is a power of 2)
+	Time			fWidth;		///< width of one day
+	size_t			fSize;		///< number of events
+	size_t			fCurBucket;	///< day where the search for the minimum starts
+	Time			fCurTop;	///< end of the current day
+	EventQueueNode*		fMin;		///< cached minimum, 0 if unknown
+	EventQueueNodePool	fPool;
+
+	/// unimplemented
+	CalendarQueue(const CalendarQueue&);
+	CalendarQueue& operator=(const CalendarQueue&);
+};
+
+} // namespace
+#endif
@@ -82,6 +82,13 @@ class Controller : public Entity
 	/// called before EACH event execution
 	virtual void pollInput(void);
 
+	/// the Controller reads input files and creates entities, which cannot
+	/// be undone: in optimistic runs its events wait until they are safe
+	virtual bool canRollback() const { return false; }
+
+	/// it reads input files and runs Python callbacks
+	virtual bool needsMainThread() const { return true; }
+
 	/// printing function
 	virtual void print(std::ostream&) const;
 
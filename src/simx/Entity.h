@@ -39,16 +39,20 @@
 #include "simx/Info.h"
 #include "simx/InfoRecipient.h"
 #include "simx/ExceptionServiceNotFound.h"
+#include "simx/StateSaving.h"
 //#include "simx/Service.h"
 
 #include "Random/Random.h"
 
 #include "boost/shared_ptr.hpp"
+#include "loki/AssocVector.h"
 //#include <boost/python.hpp>
 
 #include <map>
 #include <list>
+#include <vector>
 #include <utility>
+#include <typeinfo>
 
 namespace simx {
 
@@ -56,6 +60,7 @@ typedef float Weight;		///< The weight is use to distinguish the difference of d
 
 class LP;
 class Service;
+class EntityManager;
 
 /// input information for Entity
 struct EntityInput : public Input
@@ -84,6 +89,11 @@ class Entity
    /// creates services on an Entity ent
    /// to be called in a constructor of Entity-derived type after initialization
    static void createServices(Entity& ent, const EntityInput::Services& services);
+
+	/// where the entities record the traffic they send; set up by the
+	/// EntityManager constructor, before any Entity exists (the worker
+	/// threads then only read it)
+	static void setEntityManager( EntityManager& );
     
 	/// creates an entity on lp and 
 	Entity(const EntityID& id, LP& lp, const EntityInput& input);
@@ -95,7 +105,9 @@ class Entity
 
 
 
-	/// returns associated random stream (calls LP::getRandom)
+	/// returns the random stream of this entity: each entity has its own
+	/// (keyed by its ID), so what it draws does not depend on the other
+	/// entities, nor on the worker thread that executes it
 	Random::TRandom& getRandom() const;
 
 	/// returns current simulation time (calls LP::getNow())
@@ -122,7 +134,7 @@ class Entity
 	/// \param Delay after which the Info is delivered (should be >= MINDELAY)
 	/// \param Entity to deliver it to
 	/// \param Service to deliver it to
-	virtual void processOutgoingInfo(const boost::shared_ptr<const Info>, const Time&, const EntityID&, const ServiceAddress&) const;
+	virtual void processOutgoingInfo(boost::shared_ptr<const Info>, const Time&, const EntityID&, const ServiceAddress&) const;
 
 	/// sends an Info to be delivered out-of-band, i.e not a normal event-info
 	// will be sent through direct communication between simx layers
@@ -156,8 +168,48 @@ class Entity
 	/// does NOT clear the addresses at first
 	void getServiceAddresses(std::list<ServiceAddress>& addresses) const;
 
+	/// one service that can receive InfoType, and its address
+	template<typename InfoType>
+	struct Recipient
+	{
+	    ServiceAddress		fAddress;
+	    InfoRecipient<InfoType>*	fRecipient;
+	};
+
+	/// services that can receive InfoType, in the order of their addresses
+	/// (used by distributeInfo). The list is made on the first call and
+	/// kept until setService changes the services.
+	template<typename InfoType>
+	boost::shared_ptr<const std::vector<Recipient<InfoType> > > getRecipients() const;
+
+	/// incremented by every setService (tells whether a recipient list is still valid)
+	unsigned long getServicesVersion() const { return fServicesVersion; }
+
+	/// optimistic execution: whether events for the entity can be rolled back,
+	/// by default iff all its services save their state (see Service::getStateSaving)
+	/// (derived entities with state of their own have to override saveState()
+	/// and restoreState() as well)
+	virtual bool canRollback() const;
+
+	/// optimistic execution: saves the state of the entity before an event
+	/// is executed, by default the saveState() of the services that save copies
+	/// (derived classes append their own states after calling this one)
+	virtual void saveState(SavedStates&) const;
+
+	/// restores the states saved by saveState()
+	virtual void restoreState(const SavedStates&) const;
+
 	Weight getWeight(void) const;		///< Retrun the weight of the entity
 
+	/// whether the events of the entity have to be executed by the main
+	/// thread (see ky_THREADS_PER_RANK), e.g. because they run Python code
+	virtual bool needsMainThread() const { return false; }
+
+	/// the worker thread that executes the events of the entity
+	int getWorker() const { return fWorker; }
+	/// set by EntityManager when the entity is created (see SimEngine::assignWorker)
+	void setWorker(int worker) { fWorker = worker; }
+
 	/// printing function
 	virtual void print(std::ostream&) const;
 
@@ -168,11 +220,24 @@ class Entity
 
 	Weight		fWeight;   	// To indicate the different weight of the entity, default is set to 1
 
+	int		fWorker;	///< see getWorker()
+
+	mutable Random::TRandom	fRandom;	///< see getRandom()
+
 	/// map for services. boost::shared_ptr<Service> is used instead of Service* so that
 	/// when user puts a different service in a address, nothing needs to be
 	/// dealocated (the service may and may not be in other address as well)
-	typedef std::map<ServiceAddress, boost::shared_ptr<Service> >	ServiceMap;
+	/// (a sorted vector: entities have few services, and one is looked up
+	/// on every delivered Info)
+	typedef Loki::AssocVector<ServiceAddress, boost::shared_ptr<Service> >	ServiceMap;
 	ServiceMap	fServices;	///< services that live on this Entity
+
+	unsigned long	fServicesVersion;	///< see getServicesVersion()
+
+	/// recipient lists made by getRecipients(), one per Info type
+	/// (the lists are std::vector<Recipient<InfoType> >, keyed by typeid(InfoType))
+	typedef std::vector<std::pair<const std::type_info*, boost::shared_ptr<const void> > > RecipientLists;
+	mutable RecipientLists	fRecipientLists;
 	
 	/// shouldn't be needed, unimplemented
 	//Entity(const Entity&);
@@ -221,6 +286,38 @@ bool Entity::getService(ServiceAddress servAddr, boost::shared_ptr<ServiceClass>
 }
 
 
+template<typename InfoType>
+boost::shared_ptr<const std::vector<Entity::Recipient<InfoType> > > Entity::getRecipients() const
+{
+    typedef std::vector<Recipient<InfoType> > RecipientList;
+
+    for(RecipientLists::const_iterator iter = fRecipientLists.begin();
+	iter != fRecipientLists.end();
+	++iter)
+    {
+	if( *iter->first == typeid(InfoType) )
+	    return boost::static_pointer_cast<const RecipientList>( iter->second );
+    }
+
+    boost::shared_ptr<RecipientList> list( new RecipientList() );
+    for(ServiceMap::const_iterator iter = fServices.begin();
+	iter != fServices.end();
+	++iter)
+    {
+	SMART_ASSERT( iter->second )( fId ).msg("Invalid entry in ServiceMap");
+	InfoRecipient<InfoType>* recipient = dynamic_cast<InfoRecipient<InfoType>*>( iter->second.get() );
+	if( recipient )
+	{
+	    Recipient<InfoType> r;
+	    r.fAddress = iter->first;
+	    r.fRecipient = recipient;
+	    list->push_back( r );
+	}
+    }
+    fRecipientLists.push_back( std::make_pair( &typeid(InfoType), boost::shared_ptr<const void>( list ) ) );
+    return list;
+}
+
 template<typename InfoClass>
 void Entity::sendInfo(boost::shared_ptr<InfoClass>& info, const Time& delay, const EntityID& dest, const ServiceAddress& serv, const bool invalidate) const
 {
@@ -284,8 +381,11 @@ void getRequiredService(const Entity& ent, const ServiceAddress& servAddr, boost
 template<typename InfoType>
 int distributeInfo(const Entity& ent, boost::shared_ptr<InfoType> info, const Service* const exclude = 0)
 {
-    std::list<ServiceAddress> addresses;
-    ent.getServiceAddresses( addresses );
+    // the list is kept by the entity, and stays alive here even if a
+    // receive() changes the services
+    typedef std::vector<Entity::Recipient<InfoType> > RecipientList;
+    const boost::shared_ptr<const RecipientList> recipients = ent.getRecipients<InfoType>();
+    const unsigned long version = ent.getServicesVersion();
 
     //NOTE: must be to compile, doesn't work to have
     // const InfoRecipient<InfoType>* const in the signature directly
@@ -298,23 +398,28 @@ int distributeInfo(const Entity& ent, boost::shared_ptr<InfoType> info, const Se
     }
 
     int counter = 0;
-    for(std::list<ServiceAddress>::const_iterator iter = addresses.begin();
-        iter != addresses.end();
+    for(typename RecipientList::const_iterator iter = recipients->begin();
+        iter != recipients->end();
         ++iter)
     {
-        boost::shared_ptr<InfoRecipient<InfoType> > service;
-	if( ent.getService( *iter, service ) )
+	InfoRecipient<InfoType>* service = iter->fRecipient;
+	if( ent.getServicesVersion() != version )
 	{
-    	    SMART_ASSERT( service )( *iter )( ent ).msg("Invalid service entry on entity");
-	    if( &(*service) == ptrExclude )
-	    {
-	        /// don't inform it
+	    // a receive() changed the services: look the address up again
+	    boost::shared_ptr<InfoRecipient<InfoType> > current;
+	    if( !ent.getService( iter->fAddress, current ) )
 		continue;
-	    }
-	    
-	    service->receive( info );
-	    counter++;
-	} // else the service cannot receive the InfoType info
+	    service = current.get();
+	}
+	SMART_ASSERT( service )( iter->fAddress )( ent ).msg("Invalid service entry on entity");
+	if( service == ptrExclude )
+	{
+	    /// don't inform it
+	    continue;
+	}
+
+	service->receive( info );
+	counter++;
     }
 
     return counter;
@@ -48,6 +48,7 @@ class BaseEntityCreator
     public:
   virtual ~BaseEntityCreator() {}
 	virtual void preCreate(const EntityID&, const Input& input) const = 0;	///< method that gets called for EVERY input entity on EVERY node
+	virtual bool hasPreCreate() const { return true; }	///< may preCreate do anything (e.g. look up the entities created before)?
   virtual boost::shared_ptr<Entity> create(const EntityID&, LP&, const Input& input, const Entity::ClassType& type = "") const = 0;	///< method that actually creates it
     private:
 };
@@ -84,6 +85,11 @@ class DerivedEntityCreator : public BaseEntityCreator
 	    (*fPreCreator)(id, *in);
 	}
 
+	virtual bool hasPreCreate() const
+	{
+	    return fPreCreator != 0;
+	}
+
   virtual boost::shared_ptr<Entity> create(const EntityID& id, LP& lp, const Input& input, 
 					   const Entity::ClassType& type) const
 	{
@@ -117,6 +123,10 @@ class PyEntityCreator : public BaseEntityCreator {
     {
       // nothing here for now
     }
+    virtual bool hasPreCreate() const
+    {
+      return false;
+    }
   
   void registerObject( const Entity::ClassType& name, 
 		       const boost::python::object& py_entity_class );
@@ -0,0 +1,95 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    EntityGraph.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Weighted graph of entities and the traffic between them, partitioned
+//     with METIS (vendored in src/minissf/metis) to place entities on LPs
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_ENTITYGRAPH
+#define NISAC_SIMX_ENTITYGRAPH
+
+#include "simx/type.h"
+#include "simx/EntityIndex.h"
+
+#include <vector>
+#include <map>
+#include <iostream>
+
+namespace simx {
+
+/// \class EntityGraph EntityGraph.h "simx/EntityGraph.h"
+///
+/// \brief undirected graph with entities as vertices
+///
+/// Vertex weights are the work an entity takes (Entity::getWeight()), edge
+/// weights the number of Infos sent between the two entities (either way).
+/// The text format (read() and write()) has one item per line:
+///   v <EntityID> <weight>			e.g. "v (p 12) 1"
+///   e <EntityID> <EntityID> <weight>	e.g. "e (p 12) (p 13) 42"
+/// lines starting with '#' are ignored. Vertices without a "v" line have
+/// weight 1. Repeated edges add up, so graphs written by several ranks can
+/// simply be read one after another.
+class EntityGraph
+{
+    public:
+	EntityGraph();
+
+	/// sets the weight of a vertex (adds the vertex if needed)
+	void setVertexWeight( const EntityID& id, double weight );
+	/// adds weight to the edge between a and b (adds the vertices if needed)
+	void addEdge( const EntityID& a, const EntityID& b, double weight );
+
+	size_t getNumVertices() const { return fIds.size(); }
+	size_t getNumEdges() const { return fNumEdges; }
+	/// ID of the i-th vertex
+	const EntityID& getVertexId( size_t i ) const { return fIds[i]; }
+
+	/// reads the graph from the text format, adding to what is there
+	/// returns false on a malformed line
+	bool read( std::istream& is );
+	/// writes the graph in the text format
+	void write( std::ostream& os ) const;
+
+	/// splits the vertices into numParts parts with METIS, minimizing
+	/// the weight of cut edges while balancing the vertex weights.
+	/// part[i] is set to the part of the i-th vertex.
+	/// returns the weight of the cut edges
+	long partition( int numParts, std::vector<LPID>& part ) const;
+
+    private:
+	/// index of the vertex, adds it (with weight 1) if needed
+	int getVertex( const EntityID& id );
+
+	std::vector<EntityID>			fIds;		///< vertex -> EntityID
+	std::vector<double>			fWeights;	///< vertex weights
+	std::vector<bool>			fHasWeight;	///< weight was set (is written out)
+	std::vector< std::map<int, double> >	fEdges;		///< adjacency (both directions)
+	EntityIndex<int>			fVertexIndex;	///< EntityID -> vertex
+	size_t					fNumEdges;
+};
+
+} // namespace
+#endif // NISAC_SIMX_ENTITYGRAPH
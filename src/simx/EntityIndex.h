@@ -0,0 +1,348 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    EntityIndex.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Lookup table keyed by EntityID
+//     Replaces std::map in EntityManager (entities on this machine, where
+//     entities are placed): every delivered and every sent event looks up
+//     its destination entity, so this has to be a few loads, not a tree walk
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_ENTITYINDEX
+#define NISAC_SIMX_ENTITYINDEX
+
+#include "simx/type.h"
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <climits>
+
+namespace simx {
+
+/// \class EntityIndex EntityIndex.h "simx/EntityIndex.h"
+///
+/// \brief maps EntityID to Value
+///
+/// One value (given to the constructor, Value() by default) marks
+/// empty slots and cannot be stored.
+///
+/// There is one table per entity type (the char of EntityID). Numeric IDs
+/// are normally dense and start near 0, so each table keeps a flat array
+/// indexed directly by the numeric ID. IDs that would make the array too
+/// sparse (negative, or far above the number of entities of the type) go to
+/// an open-addressing hash table (linear probing) instead.
+/// Entries can only be added, never removed.
+///
+/// With several ranks, the entities of one rank are those placed on its
+/// LPs, by default the IDs whose remainder modulo the number of LPs is one
+/// of its LPs. setLayout() tells the index so: the flat array then only
+/// has slots for such IDs (ID / modulus * number of remainders + which
+/// remainder), and the others go to the hash table.
+template<class Value>
+class EntityIndex
+{
+    public:
+	typedef std::pair<EntityID, const Value*>	Entry;
+
+	explicit EntityIndex( const Value& empty = Value() )
+	    :	fEmpty( empty ),
+		fSize( 0 ),
+		fModulus( 1 ),
+		fSlotOfRemainder( 1, 0 ),
+		fRemainderOfSlot( 1, 0 )
+	{
+	    std::fill( fTables, fTables + kNumTypes, static_cast<Table*>(0) );
+	}
+
+	/// the IDs expected (in the flat array) are those whose remainder
+	/// modulo modulus is in remainders; must be called while empty
+	void setLayout( simxLong modulus, const std::vector<simxLong>& remainders )
+	{
+	    SMART_ASSERT( fSize == 0 )( fSize ).msg("EntityIndex: layout set when not empty");
+	    SMART_ASSERT( modulus > 0 )( modulus );
+	    fModulus = modulus;
+	    fSlotOfRemainder.assign( modulus, -1 );
+	    fRemainderOfSlot.clear();
+	    // in increasing order, so that the slots are in the order of the IDs
+	    std::vector<simxLong> sorted( remainders );
+	    std::sort( sorted.begin(), sorted.end() );
+	    for( std::vector<simxLong>::const_iterator iter = sorted.begin();
+		iter != sorted.end();
+		++iter )
+	    {
+		if( 0 <= *iter && *iter < modulus && fSlotOfRemainder[ *iter ] < 0 )
+		{
+		    fSlotOfRemainder[ *iter ] = fRemainderOfSlot.size();
+		    fRemainderOfSlot.push_back( *iter );
+		}
+	    }
+	}
+
+	~EntityIndex()
+	{
+	    clear();
+	}
+
+	/// number of entries
+	size_t size() const
+	{
+	    return fSize;
+	}
+
+	/// returns address of the stored value, or 0 if id is not there
+	const Value* find( const EntityID& id ) const
+	{
+	    const Table* table = fTables[ typeIndex( id.get<0>() ) ];
+	    if( !table )
+		return 0;
+	    const simxLong key = id.get<1>();
+	    const simxLong slot = denseSlot( key );
+	    if( slot >= 0 && static_cast<unsigned long long>(slot) < table->fDense.size() )
+	    {
+		const Value& v = table->fDense[ slot ];
+		if( !( v == fEmpty ) )
+		    return &v;
+	    }
+	    if( table->fHashUsed == 0 )
+		return 0;
+	    const size_t mask = table->fHash.size() - 1;
+	    for( size_t i = hash( key ) & mask; ; i = (i+1) & mask )
+	    {
+		const Slot& slot = table->fHash[i];
+		if( slot.fValue == fEmpty )
+		    return 0;
+		if( slot.fKey == key )
+		    return &slot.fValue;
+	    }
+	}
+
+	/// adds the entry, returns false (and keeps the old one) if id is already there
+	bool insert( const EntityID& id, const Value& value )
+	{
+	    if( find( id ) )
+		return false;
+	    set( id, value );
+	    return true;
+	}
+
+	/// adds or replaces the entry
+	void set( const EntityID& id, const Value& value )
+	{
+	    SMART_ASSERT( !( value == fEmpty ) ).msg("EntityIndex: cannot store the empty value");
+	    Table*& table = fTables[ typeIndex( id.get<0>() ) ];
+	    if( !table )
+		table = new Table();
+	    const simxLong key = id.get<1>();
+
+	    // replacing?
+	    Value* old = const_cast<Value*>( find( id ) );
+	    if( old )
+	    {
+		*old = value;
+		return;
+	    }
+
+	    const simxLong slot = denseSlot( key );
+	    if( slot >= 0 && static_cast<unsigned long long>(slot) < denseLimit( *table ) )
+	    {
+		if( static_cast<unsigned long long>(slot) >= table->fDense.size() )
+		    table->fDense.resize( slot + 1, fEmpty );
+		table->fDense[ slot ] = value;
+	    } else
+	    {
+		// keep the load factor at most 1/2
+		if( 2*(table->fHashUsed + 1) > table->fHash.size() )
+		    rehash( *table );
+		const size_t mask = table->fHash.size() - 1;
+		size_t i = hash( key ) & mask;
+		while( !( table->fHash[i].fValue == fEmpty ) )
+		    i = (i+1) & mask;
+		table->fHash[i].fKey = key;
+		table->fHash[i].fValue = value;
+		table->fHashUsed++;
+	    }
+	    table->fSize++;
+	    fSize++;
+	}
+
+	/// fills entries with all entries (of the given type only, unless it is
+	/// the default char), in the order of EntityID (the order std::map would have)
+	void getEntries( std::vector<Entry>& entries, char type = EntityID().get<0>() ) const
+	{
+	    entries.clear();
+	    for( int c = CHAR_MIN; c <= CHAR_MAX; ++c )
+	    {
+		if( type != EntityID().get<0>() && type != static_cast<char>(c) )
+		    continue;
+		const Table* table = fTables[ typeIndex( static_cast<char>(c) ) ];
+		if( !table )
+		    continue;
+		const size_t first = entries.size();
+		for( typename std::vector<Slot>::const_iterator iter = table->fHash.begin();
+		    iter != table->fHash.end();
+		    ++iter )
+		{
+		    if( !( iter->fValue == fEmpty ) )
+			entries.push_back( Entry( EntityID( c, iter->fKey ), &iter->fValue ) );
+		}
+		for( size_t slot = 0; slot < table->fDense.size(); ++slot )
+		{
+		    if( !( table->fDense[slot] == fEmpty ) )
+			entries.push_back( Entry( EntityID( c, denseKey( slot ) ), &table->fDense[slot] ) );
+		}
+		if( table->fHashUsed )
+		    std::sort( entries.begin() + first, entries.end(), entryLess );
+	    }
+	}
+
+	/// fills ids with the IDs of the entries getEntries would give, in the
+	/// same order (unlike the addresses there, these stay valid when
+	/// entries are added)
+	void getIds( std::vector<EntityID>& ids, char type = EntityID().get<0>() ) const
+	{
+	    std::vector<Entry> entries;
+	    getEntries( entries, type );
+	    ids.clear();
+	    ids.reserve( entries.size() );
+	    for( typename std::vector<Entry>::const_iterator iter = entries.begin();
+		iter != entries.end();
+		++iter )
+		ids.push_back( iter->first );
+	}
+
+	/// removes all entries
+	void clear()
+	{
+	    for( size_t i = 0; i < kNumTypes; ++i )
+	    {
+		delete fTables[i];
+		fTables[i] = 0;
+	    }
+	    fSize = 0;
+	}
+
+    private:
+	static const size_t kNumTypes = 1 << CHAR_BIT;
+	/// IDs below this always go to the flat array
+	static const size_t kMinDense = 1024;
+
+	/// hash table entry, empty iff fValue is the empty value
+	struct Slot
+	{
+	    simxLong	fKey;
+	    Value	fValue;
+	};
+
+	/// all entities of one type
+	struct Table
+	{
+	    Table() : fDense(), fHash(), fHashUsed( 0 ), fSize( 0 ) {}
+
+	    std::vector<Value>	fDense;		///< indexed by the numeric ID
+	    std::vector<Slot>	fHash;		///< size is 0 or a power of 2
+	    size_t		fHashUsed;	///< used slots of fHash
+	    size_t		fSize;		///< entries in both
+	};
+
+	static size_t typeIndex( char c )
+	{
+	    return static_cast<unsigned char>( c );
+	}
+
+	/// Fibonacci hashing, the low bits of consecutive keys spread well
+	static size_t hash( simxLong key )
+	{
+	    const unsigned long long h = static_cast<unsigned long long>(key) * 0x9E3779B97F4A7C15ULL;
+	    return static_cast<size_t>( h ^ (h >> 32) );
+	}
+
+	/// where key goes in the flat array, -1 if it does not go there
+	simxLong denseSlot( simxLong key ) const
+	{
+	    if( key < 0 )
+		return -1;
+	    if( fModulus == 1 )
+		return key;
+	    const simxLong s = fSlotOfRemainder[ key % fModulus ];
+	    if( s < 0 )
+		return -1;
+	    return ( key / fModulus ) * static_cast<simxLong>( fRemainderOfSlot.size() ) + s;
+	}
+
+	/// the key of a slot of the flat array
+	simxLong denseKey( size_t slot ) const
+	{
+	    const size_t n = fRemainderOfSlot.size();
+	    return static_cast<simxLong>( slot / n ) * fModulus + fRemainderOfSlot[ slot % n ];
+	}
+
+	/// slots below the limit are in the flat array:
+	/// the array is allowed to be at most about half empty
+	static unsigned long long denseLimit( const Table& table )
+	{
+	    return std::max<unsigned long long>( std::max<unsigned long long>( kMinDense, 2*(table.fSize+1) ),
+						 table.fDense.size() );
+	}
+
+	void rehash( Table& table ) const
+	{
+	    std::vector<Slot> old;
+	    old.swap( table.fHash );
+	    Slot empty;
+	    empty.fKey = 0;
+	    empty.fValue = fEmpty;
+	    table.fHash.resize( old.empty() ? 16 : 2*old.size(), empty );
+	    const size_t mask = table.fHash.size() - 1;
+	    for( typename std::vector<Slot>::const_iterator iter = old.begin(); iter != old.end(); ++iter )
+	    {
+		if( iter->fValue == fEmpty )
+		    continue;
+		size_t i = hash( iter->fKey ) & mask;
+		while( !( table.fHash[i].fValue == fEmpty ) )
+		    i = (i+1) & mask;
+		table.fHash[i] = *iter;
+	    }
+	}
+
+	static bool entryLess( const Entry& a, const Entry& b )
+	{
+	    return a.first < b.first;
+	}
+
+	const Value	fEmpty;			///< marks empty slots
+	Table*		fTables[ kNumTypes ];	///< indexed by the entity type, created on first use
+	size_t		fSize;
+	simxLong	fModulus;		///< see setLayout, 1 if not set
+	std::vector<simxLong>	fSlotOfRemainder;	///< remainder -> its place in a group of slots, -1 if none
+	std::vector<simxLong>	fRemainderOfSlot;	///< the other way
+
+	/// unimplemented
+	EntityIndex(const EntityIndex&);
+	EntityIndex& operator=(const EntityIndex&);
+};
+
+} // namespace
+#endif // NISAC_SIMX_ENTITYINDEX
@@ -0,0 +1,184 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    EntityLoader.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Creates the entities of the entity files for EntityManager
+//     with several threads
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_ENTITYLOADER
+#define NISAC_SIMX_ENTITYLOADER
+
+#include "simx/type.h"
+#include "simx/EntityData.h"
+#include "simx/BinaryInput.h"
+
+#include <boost/shared_ptr.hpp>
+#include <pthread.h>
+
+#include <vector>
+#include <deque>
+
+namespace simx {
+
+class LP;
+class Input;
+class Entity;
+class EntityManager;
+class BaseEntityCreator;
+class BinaryInputIndex;
+
+/// an entity record of a file, on its way to become an Entity
+struct EntityRecord
+{
+    EntityRecord();
+
+    EntityID			fId;
+    Entity::ClassType		fType;
+    ProfileID			fProfileId;
+    EntityData			fText;		///< the record, if from a text file
+    const char*			fBinaryData;	///< custom data, if from a binary file
+    size_t			fBinarySize;
+    BinaryInputRange		fRange;		///< where the binary record is in the file
+    const BaseEntityCreator*	fCreator;	///< 0 if the type is not registered
+    bool			fParallel;	///< may be read and created in any thread (not Python)
+    boost::shared_ptr<Input>	fInput;
+    LP*				fLp;		///< where it is created, 0 if not on this rank
+    boost::shared_ptr<Entity>	fEntity;
+};
+
+typedef std::vector<EntityRecord> EntityBatch;
+
+/// \class EntityLoader EntityLoader.h "simx/EntityLoader.h"
+///
+/// \brief creates the entities of the entity files with several threads
+///
+/// A reading thread reads the file in batches of records, ahead of the
+/// others. For each batch, the loader threads (the main thread is one of
+/// them) make the Inputs of the records; the main thread then runs the
+/// pre-creating and placing functions, in the order of the file; with
+/// ENTITY_PARALLEL_CREATE on, the loader threads construct the entities
+/// of this rank, each one into the records it took; and the main thread
+/// adds them to EntityManager (constructing those not constructed yet),
+/// again in the order of the file (so that they get the same worker
+/// threads). The entity constructors have no thread-safety contract (they
+/// may use the random streams, the output, the InfoManager...), so they
+/// run in the main thread unless ENTITY_PARALLEL_CREATE is on.
+/// Python entities are left to the main thread, and so is any record a
+/// loader thread got an exception on (the main thread then gets the
+/// exception itself).
+///
+/// Before a type with a pre-creating function is pre-created, the main
+/// thread creates and adds the records of the batch before it, so a
+/// pre-creating function finds all the entities before it, as without
+/// threads (at the cost of creating those in one thread). The placing
+/// functions are not waited for: they run before the entities before
+/// them in the batch are created, and must not look them up.
+class EntityLoader
+{
+    public:
+	/// starts numThreads - 1 loader threads
+	EntityLoader( EntityManager& manager, int numThreads );
+	/// stops the threads
+	~EntityLoader();
+
+	/// creates the entities of a file (text, or binary if binary is not 0),
+	/// adds the records to index if it is not 0
+	/// returns the number of records
+	long long load( EntityData::Reader* text, BinaryEntityReader* binary, BinaryInputIndex* index );
+
+    private:
+	enum Phase
+	{
+	    kParse,		///< make the Inputs
+	    kConstruct,		///< construct the entities of this rank
+	    kStop		///< the loader threads are to finish
+	};
+
+	// reading
+	void readBatch( EntityBatch& batch );
+	/// the next batch, 0 after the last one
+	EntityBatch* takeBatch();
+	void releaseBatch( EntityBatch* batch );
+	void stopReading();
+	static void* readThread( void* );
+	void readAhead();
+
+	// loading
+	/// runs the phase on the batch in all loader threads
+	void runPhase( Phase phase, EntityBatch& batch );
+	/// takes slices of the batch until there are none left
+	void work( Phase phase, EntityBatch& batch );
+	static void* loaderThread( void* );
+	void loaderLoop();
+
+	/// the main thread's part between the phases
+	void placeRecords( EntityBatch& batch, BinaryInputIndex* index );
+	/// adds the records of the batch up to end (not included)
+	void addRecords( EntityBatch& batch, size_t end );
+
+	boost::shared_ptr<Input> createInput( EntityRecord& record, MemoryInputStream& data ) const;
+
+	EntityManager&		fManager;
+	MemoryInputStream	fData;		///< for the main thread
+	long long		fNumRecords;	///< of the current file
+	size_t			fNumAdded;	///< records of the batch added so far
+	bool			fParallelCreate;	///< construct in the loader threads too? (ENTITY_PARALLEL_CREATE)
+
+	// reading
+	EntityData::Reader*	fText;
+	BinaryEntityReader*	fBinary;
+	bool			fReading;	///< is the reading thread running?
+	pthread_t		fReadThread;
+	pthread_mutex_t		fReadMutex;
+	pthread_cond_t		fReadCond;	///< a batch was read, or taken
+	std::deque<EntityBatch*> fReady;	///< batches read ahead, in order
+	std::vector<EntityBatch*> fFree;	///< batches to reuse
+	bool			fReadDone;	///< the last batch was read
+	bool			fReadStop;	///< the reading thread is to finish
+
+	// loader threads
+	std::vector<pthread_t>	fThreads;
+	pthread_mutex_t		fMutex;
+	pthread_cond_t		fWorkCond;	///< a phase started
+	pthread_cond_t		fDoneCond;	///< a loader thread finished the phase
+	int			fGeneration;	///< phases started so far
+	Phase			fPhase;
+	EntityBatch*		fBatch;
+	volatile size_t		fNext;		///< first record of the batch not taken yet
+	int			fNumBusy;	///< loader threads not done with the phase
+
+	static const size_t	kBatchSize = 4096;	///< records
+	static const size_t	kSlice = 64;		///< records taken at a time
+	static const size_t	kReadAhead = 2;		///< batches
+
+	/// unimplemented
+	EntityLoader(const EntityLoader&);
+	EntityLoader& operator=(const EntityLoader&);
+};
+
+} // namespace
+
+#endif
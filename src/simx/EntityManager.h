@@ -34,6 +34,8 @@
 #include "simx/control.h"
 #include "simx/type.h"
 #include "simx/EntityFactory.h"
+#include "simx/EntityIndex.h"
+#include "simx/EntityGraph.h"
 #include "simx/InputHandler.h"
 #include "simx/logger.h"
 
@@ -43,6 +45,8 @@
 #include <set>
 #include <string>
 #include <map>
+#include <vector>
+#include <typeinfo>
 
 #include <boost/python.hpp>
 
@@ -53,6 +57,7 @@ namespace simx {
 class Entity;
 class EntityData;
 class Controller;
+class BinaryInputIndex;
 
   // fwd declaration of PyEntityData
   namespace Python {
@@ -63,6 +68,7 @@ class EntityManager
 {
     friend EntityManager& theEntityManager();
     friend class Loki::CreateUsingNew<EntityManager>;
+    friend class EntityLoader;
   
 
     public:
@@ -84,6 +90,24 @@ class EntityManager
 	/// the pointer is NOT 0 after the call if the return value is true
 	template<class EntityClass> 
 	bool getEntity( const EntityID& id, boost::shared_ptr<EntityClass>& ) const;
+	/// the same for plain Entity, needs no cast
+	bool getEntity( const EntityID& id, boost::shared_ptr<Entity>& ptr ) const
+	{
+	    const boost::shared_ptr<Entity>* p = fEntityIndex.find( id );
+	    if( !p )
+		return false;
+	    ptr = *p;
+	    return true;
+	}
+
+	/// returns the entity given its ID, or 0 if it is not on this machine
+	/// (fast path for event delivery: no cast, no reference counting;
+	/// entities live until the end of the simulation)
+	Entity* findEntity( const EntityID& id ) const
+	{
+	    const boost::shared_ptr<Entity>* p = fEntityIndex.find( id );
+	    return p ? p->get() : 0;
+	}
    
     
 	/// LK: should NOT be needed, use probeEntities instead
@@ -91,8 +115,44 @@ class EntityManager
 	///void getEntityIds(std::list<EntityID>& ids) const;
 
 	/// returns an LP where an Entity sits
+	/// (answers come from a placement table of the created entities and
+	/// the fixed placement, the placing functions are called for others)
 	LPID findEntityLpId( const EntityID& id ) const;
 
+	/// from now on other threads may look up and place entities too, so
+	/// the placement table takes a lock; call before starting them
+	void sharePlacements() { fPlacementShared = true; }
+
+	/// fixes the LP where an Entity sits, the placing functions will not be
+	/// asked about it. Must be done the same way on all machines, before the
+	/// Entity is created or sent anything.
+	void setEntityLpId( const EntityID& id, LPID lpId );
+
+	/// are the entities of an input index still placed where the index
+	/// says (see BinaryInputIndex)? Placement files, partitions and the
+	/// placing functions may have changed since it was made.
+	bool checkPlacements( const BinaryInputIndex& index ) const;
+
+	/// reads fixed placement from a file (see ky_PLACEMENT_FILE):
+	/// one "EntityID LPID" per line, lines starting with '#' are ignored
+	/// returns the number of entries read
+	long loadPlacementFile( const std::string& fileName );
+
+	/// prints how the placement table did
+	void printPlacementStats( std::ostream& ) const;
+
+	/// starts counting Infos sent between entities
+	void startTrafficRecording();
+	/// counts one Info sent from an entity to another (if recording)
+	void recordTraffic( const EntityID& from, const EntityID& to )
+	{
+	    if( fTrafficGraph )
+		recordTrafficPrivate( from, to );
+	}
+	/// writes the recorded traffic and weights of the entities on this
+	/// machine (as an EntityGraph)
+	void writeTrafficGraph( const std::string& fileName ) const;
+
 	/// Registers entity, given its class (and class for its input)
 	/// the second parameter is a pointer to a function that 
 	/// will be run on every node for every entity on input (regardless of whether it will
@@ -154,6 +214,11 @@ class EntityManager
   bool createEntityonLP(const EntityID&, const Entity::ClassType&, 
 			const ProfileID, const boost::shared_ptr<Input>&);
 
+	/// puts a new Entity on this machine into the index, and assigns it
+	/// a worker thread; not allowed while the simulation runs with several
+	/// workers (they read the index without a lock)
+	void addEntity( const EntityID& id, const boost::shared_ptr<Entity>& entity );
+
   bool createPyEntityonLP(const EntityID& id, const boost::python::object& type, 
 			  const ProfileID profileId, const boost::shared_ptr<Input>& input);
 
@@ -162,12 +227,70 @@ class EntityManager
 	/// must ALWAYS be able to place an Entity
 	LPID defaultEntityPlacingFunction( const EntityID& entId ) const;
 
+	void recordTrafficPrivate( const EntityID& from, const EntityID& to );
+
+	/// asks the placing functions (ignores the placement table)
+	LPID computeEntityLpId( const EntityID& entId ) const;
+
+	/// is a pre-creating function registered for any entity type?
+	bool hasPreCreators() const;
+
+	/// the traffic graph is updated by whichever worker thread sends (see
+	/// ky_THREADS_PER_RANK), the placement table by the loader threads while
+	/// others read it (see sharePlacements), these serialize that
+	void lock( volatile int& l ) const
+	{
+	    while( __sync_lock_test_and_set( &l, 1 ) )
+		while( l ) {}
+	}
+	void unlock( volatile int& l ) const
+	{
+	    __sync_lock_release( &l );
+	}
+
+	/// findEntityLpId for an Entity about to be created: unless its placement
+	/// is fixed, the placing functions are asked again (the pre-creator may
+	/// have changed their answer) and the table is updated
+	LPID placeEntity( const EntityID& entId );
+
 	typedef bool (*EntityPlacingFunction)(const EntityID&, LPID&);
 	typedef std::vector<EntityPlacingFunction> EntityPlacingFunctionContainer;
 	EntityPlacingFunctionContainer	fEntityPlacingFunctionContainer;	///< holds info about which functions to call to find an Entitie's LPID
+
+	/// entry of the placement table
+	struct Placement
+	{
+	    Placement( LPID lpId = LPID(-1), bool fixed = false ) : fLpId( lpId ), fFixed( fixed ) {}
+	    bool operator==( const Placement& p ) const { return fLpId == p.fLpId && fFixed == p.fFixed; }
+
+	    LPID	fLpId;
+	    bool	fFixed;		///< set by setEntityLpId, not by a placing function
+	};
+	typedef EntityIndex<Placement>	PlacementTable;
+	mutable PlacementTable	fPlacementTable;	///< EntityID -> LPID (of created entities, and fixed ones)
+	mutable uint64_t	fPlacementLookups;	///< findEntityLpId calls
+	mutable uint64_t	fPlacementMisses;	///< ... that had to ask the placing functions
+	mutable volatile int	fPlacementLock;
+	bool			fPlacementShared;	///< see sharePlacements
+
+	/// fPlacementLock, when other threads may use the table
+	void lockPlacements() const
+	{
+	    if( fPlacementShared )
+		lock( fPlacementLock );
+	}
+	void unlockPlacements() const
+	{
+	    if( fPlacementShared )
+		unlock( fPlacementLock );
+	}
+
+	/// traffic between entities, when recording
+	boost::shared_ptr<EntityGraph>	fTrafficGraph;
+	volatile int			fTrafficLock;
     
-	typedef std::map<EntityID,boost::shared_ptr<Entity> >	EntityPtrMap;
-	EntityPtrMap	fEntityPtrMap;	///< stores entities that sit on this machine
+	typedef EntityIndex<boost::shared_ptr<Entity> >	EntityPtrIndex;
+	EntityPtrIndex	fEntityIndex;	///< stores entities that sit on this machine (see addEntity)
 
 	/// produces Inputs (from input stream) to give to an Entity constructor
 	InputHandler<Entity::ClassType>	fInputHandler;
@@ -244,24 +367,30 @@ void EntityManager::registerEntity(const Entity::ClassType& name,
 template<class EntityClass>
 bool EntityManager::getEntity( const EntityID& id, boost::shared_ptr<EntityClass>& ptr ) const
 {
-    EntityPtrMap::const_iterator iter = fEntityPtrMap.find( id );
-    if( iter == fEntityPtrMap.end() )
+    const boost::shared_ptr<Entity>* entPtr = fEntityIndex.find( id );
+    if( !entPtr )
     {
 	return false;
-    } else
+    }
+
+    // if the entity is exactly of the requested class, a static cast will do
+    if( typeid( **entPtr ) == typeid( EntityClass ) )
     {
-	boost::shared_ptr<EntityClass> ent = boost::dynamic_pointer_cast<EntityClass>(iter->second);
-	if( !ent )
-	{
-	    Logger::warn() << "EntityManager: cannot cast entity " << id
-		<< " to type " << typeid(EntityClass).name() << std::endl;
-	    return false;
-	}
-	
-	ptr = ent;
-	SMART_ASSERT( ptr );
+	ptr = boost::static_pointer_cast<EntityClass>( *entPtr );
 	return true;
     }
+
+    boost::shared_ptr<EntityClass> ent = boost::dynamic_pointer_cast<EntityClass>( *entPtr );
+    if( !ent )
+    {
+	Logger::warn() << "EntityManager: cannot cast entity " << id
+	    << " to type " << typeid(EntityClass).name() << std::endl;
+	return false;
+    }
+
+    ptr = ent;
+    SMART_ASSERT( ptr );
+    return true;
 }
 
 template<typename T>
@@ -273,16 +402,21 @@ void EntityManager::probeEntities( void (T::*method)(void), boost::tuples::eleme
     SMART_ASSERT( method ).msg("Cannot probe with NULL member pointer");
     
     
-    for(EntityPtrMap::const_iterator iter = fEntityPtrMap.begin();
-	iter != fEntityPtrMap.end();  
+    // only look at entities of the right kind (all if eType is the default)
+    // (entities the method creates are not probed)
+    std::vector<EntityID> ids;
+    fEntityIndex.getIds( ids, eType );
+    for(std::vector<EntityID>::const_iterator iter = ids.begin();
+	iter != ids.end();  
 	++iter ) 
     {
-	// only look at entities of the right kind
-	if( eType != EntityID().get<0>() && eType != iter->first.get<0>() )
-	    continue;
-    
+	// looked up each time: the method may create entities, which can
+	// move the others within the index
+	const boost::shared_ptr<Entity>* ent = fEntityIndex.find( *iter );
+	SMART_ASSERT( ent )( *iter );
+
 	// get the pointer to a (possibly derived from Entity) class T
-	boost::shared_ptr<T> entPtr = boost::dynamic_pointer_cast<T>( iter->second );
+	T* entPtr = dynamic_cast<T*>( ent->get() );
 	
 	// if success, then run method (otherwise the object was not derived from T, and will not be able to respond)
 	if( entPtr )
@@ -303,16 +437,21 @@ void EntityManager::probeEntities( void (T::*method)(Arg1), Arg1a& arg1, boost::
     SMART_ASSERT( method ).msg("Cannot probe with NULL member pointer");
     
     
-    for(EntityPtrMap::const_iterator iter = fEntityPtrMap.begin();
-	iter != fEntityPtrMap.end();  
+    // only look at entities of the right kind (all if eType is the default)
+    // (entities the method creates are not probed)
+    std::vector<EntityID> ids;
+    fEntityIndex.getIds( ids, eType );
+    for(std::vector<EntityID>::const_iterator iter = ids.begin();
+	iter != ids.end();  
 	++iter ) 
     {
-	// only look at entities of the right kind
-	if( eType != EntityID().get<0>() && eType != iter->first.get<0>() )
-	    continue;
-    
+	// looked up each time: the method may create entities, which can
+	// move the others within the index
+	const boost::shared_ptr<Entity>* ent = fEntityIndex.find( *iter );
+	SMART_ASSERT( ent )( *iter );
+
 	// get the pointer to a (possibly derived from Entity) class T
-	boost::shared_ptr<T> entPtr = boost::dynamic_pointer_cast<T>( iter->second );
+	T* entPtr = dynamic_cast<T*>( ent->get() );
 	
 	// if success, then run method (otherwise the object was not derived from T, and will not be able to respond)
 	if( entPtr )
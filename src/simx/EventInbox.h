@@ -0,0 +1,99 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    EventInbox.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Lock-free multi-producer single-consumer inbox for events
+//     Other threads (e.g. the MPI listening thread) push events here, the
+//     SimEngine main thread moves them into its EventQueue in batches,
+//     so that the queue itself needs no locking
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_EVENTINBOX
+#define NISAC_SIMX_EVENTINBOX
+
+#include "simx/EventInfo.h"
+#include "simx/EventQueue.h"
+
+#include <vector>
+
+namespace simx {
+
+/// \class EventInbox EventInbox.h "simx/EventInbox.h"
+///
+/// \brief MPSC inbox of EventInfos
+///
+/// push() may be called from any number of threads, drainInto() only
+/// from a single (consumer) thread. Producers prepend to a singly-linked
+/// list with a CAS, the consumer grabs the whole list with one atomic exchange
+/// and reverses it, so the events enter the queue in the order they were pushed.
+class EventInbox
+{
+    public:
+	EventInbox();
+	~EventInbox();
+
+	/// adds an event, which is taken over (e is left empty);
+	/// thread-safe, never blocks
+	void push( EventInfo& e );
+
+	/// moves all events pushed so far into the queue (in push order),
+	/// returns how many were moved
+	/// ONLY ONE THREAD MAY CALL THIS
+	size_t drainInto( EventQueue& eq );
+
+	/// the same, but appends the events to a vector (for the caller to look
+	/// at them before they go into the queue)
+	/// ONLY ONE THREAD MAY CALL THIS
+	size_t drainInto( std::vector<EventInfo>& events );
+
+	/// only a hint when other threads are pushing
+	bool empty() const
+	{
+	    return fHead == 0;
+	}
+
+    private:
+	struct Node
+	{
+	    EventInfo	fEvent;
+	    Node*	fNext;
+	};
+
+	/// takes all the nodes out, returns them oldest first (0 if none)
+	Node* takeAll();
+
+	static Node* newNode();
+	static void freeNode( Node* );
+
+	/// most recently pushed node
+	Node* volatile	fHead;
+
+	/// unimplemented
+	EventInbox(const EventInbox&);
+	EventInbox& operator=(const EventInbox&);
+};
+
+} // namespace
+#endif
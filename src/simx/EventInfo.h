@@ -53,6 +53,11 @@ class EventInfo
 	/// default copy constructor and operator= make a *shallow* copy (fInfo ptr is copied)
 	EventInfo();
 	virtual ~EventInfo();
+
+	/// exchanges the contents of the two events; this is how events are handed
+	/// over along the send path (Entity -> LP -> SimEngine -> EventQueue and back),
+	/// so that the Info reference count is not touched on the way
+	void swap(EventInfo& other);
    
 
 	/// pack EventInfo
@@ -73,6 +78,11 @@ class EventInfo
         // WHEN:
         Time getDelay() const;
 	Time getTime() const;
+	// optimistic execution:
+	/// identifies the event, to cancel it by an anti-message (0 if not set)
+	uint64_t getMessageId() const { return fMessageId; }
+	/// an anti-message cancels the event with the same message id (and has no Info)
+	bool isAntiMessage() const { return fAntiMessage; }
 
     // SETTERS:
         // TO:
@@ -82,6 +92,11 @@ class EventInfo
 	void setTime(const Time time);
         // WHAT:
         void setInfo(const boost::shared_ptr<const Info> info);	///< info must not be NULL
+	/// takes over the info, which is left empty (info must not be NULL)
+        void takeInfo(boost::shared_ptr<const Info>& info);
+	// optimistic execution:
+	void setMessageId(uint64_t id) { fMessageId = id; }
+	void setAntiMessage(bool anti) { fAntiMessage = anti; }
 
     protected:
     private:
@@ -92,6 +107,10 @@ class EventInfo
 	// WHEN:
 	Time		fDelay;		///< time delay when event is to be delivered
 	Time      fTime;      /// The time the event will get executed
+
+	// optimistic execution:
+	uint64_t	fMessageId;	///< see getMessageId()
+	bool		fAntiMessage;	///< see isAntiMessage()
 	
 	// WHAT:
 	/// the fInfo is boost::shared_ptr<*const*> because we want to be able so send such objects
@@ -22,8 +22,10 @@
 // Author:  Lukas Kroc
 // Created: Feb 25 2010
 //
-// Description: 
+// Description:
 //     Event Queue for SimEngine
+//     The actual priority queue is pluggable (see EVENT_QUEUE config key),
+//     the implementations live in EventQueue.C, CalendarQueue.C and LadderQueue.C
 //
 // @@
 //
@@ -37,61 +39,195 @@
 #include "simx/EventInfo.h"
 
 #include <map>
+#include <vector>
+#include <string>
 
 namespace simx {
 
+/// one entry in the event queue
+/// events with the same time are ordered by fSeq (the order in which they were
+/// pushed), so that all implementations execute them in FIFO order
+struct EventQueueNode
+{
+    Time		fTime;	///< when the event is to be executed
+    uint64_t		fSeq;	///< push counter, breaks ties in fTime
+    EventInfo		fEvent;	///< the event itself
+    EventQueueNode*	fNext;	///< for intrusive lists inside the implementations
+};
+
+/// (time,seq) ordering of the nodes
+inline bool eventQueueNodeLess( const EventQueueNode* a, const EventQueueNode* b )
+{
+    return a->fTime < b->fTime || ( a->fTime == b->fTime && a->fSeq < b->fSeq );
+}
+
+/// recycles EventQueueNodes, so that the node-based queues do not hit
+/// the heap for every push
+class EventQueueNodePool
+{
+    public:
+	EventQueueNodePool();
+	~EventQueueNodePool();
+
+	/// returns a node (fields are NOT reset)
+	EventQueueNode* allocate();
+	/// gives the node back (releases the EventInfo it holds)
+	void release( EventQueueNode* );
+
+	/// number of allocate() calls
+	uint64_t getNumAllocations() const { return fNumAllocations; }
+	/// how many of them reused a released node
+	uint64_t getNumHits() const { return fNumHits; }
+	/// nodes allocated from the system
+	size_t getNumNodes() const { return fBlocks.size() * kBlockSize; }
+
+    private:
+	static const size_t kBlockSize = 1024;	///< nodes allocated at once
+
+	EventQueueNode*			fFree;		///< list of free nodes
+	EventQueueNode*			fFresh;		///< first never used node of the last block
+	std::vector<EventQueueNode*>	fBlocks;	///< all memory allocated
+
+	uint64_t			fNumAllocations;
+	uint64_t			fNumHits;
+
+	/// unimplemented
+	EventQueueNodePool(const EventQueueNodePool&);
+	EventQueueNodePool& operator=(const EventQueueNodePool&);
+};
+
+/// interface to the actual priority queue implementations
+/// (must keep the (time,seq) order of the events)
+class EventQueueImpl
+{
+    public:
+	virtual ~EventQueueImpl();
+
+	virtual bool empty() const = 0;
+	virtual size_t size() const = 0;
+	/// MUST NOT BE EMPTY
+	/// non-const since implementations may reorganize themselves,
+	/// the event in the node may be taken out (swapped) before pop()
+	virtual EventQueueNode& top() = 0;
+	/// MUST NOT BE EMPTY
+	virtual void pop() = 0;
+	/// takes the event over (swaps it in, e is left empty)
+	virtual void push( Time when, uint64_t seq, EventInfo& e ) = 0;
+	/// removes all events
+	virtual void clear() = 0;
+	/// name under which the implementation is selected in config
+	virtual const char* getName() const = 0;
+	/// the node pool of the implementation, if it has one
+	virtual const EventQueueNodePool* getNodePool() const { return 0; }
+};
+
+/// creates an implementation given its name ("multimap", "calendar" or "ladder");
+/// returns 0 if the name is unknown
+EventQueueImpl* createEventQueueImpl( const std::string& name );
+
+
 /// hold events, can add, top, and pop
 class EventQueue
 {
     public:
-	EventQueue()
+	EventQueue();
+	~EventQueue();
+
+	/// selects the underlying priority queue by name (see createEventQueueImpl),
+	/// the queue must be empty
+	/// returns false (and keeps the current one) if the name is unknown
+	bool setImplementation( const std::string& name );
+
+	/// name of the underlying priority queue
+	const char* getImplementationName() const
 	{
-	  fNumEvents = 0;
+	    return fImpl->getName();
 	}
-	
+
 	// is the queue empty?
 	bool empty() const
 	{
-	    return fQ.empty();
+	    return fImpl->empty();
 	}
-	
+
+	// number of events in the queue
+	size_t size() const
+	{
+	    return fImpl->size();
+	}
+
 	// lets one have look at the top entry
 	// MUST NOT BE EMPTY
 	const EventInfo& top() const
 	{
-	    SMART_ASSERT( !fQ.empty() );
-	    return fQ.begin()->second;
+	    SMART_ASSERT( !fImpl->empty() );
+	    return fImpl->top().fEvent;
+	}
+
+	// time of the top entry
+	// MUST NOT BE EMPTY
+	Time topTime() const
+	{
+	    SMART_ASSERT( !fImpl->empty() );
+	    return fImpl->top().fTime;
 	}
 
 	// removes the top entry
 	// MUST NOT BE EMPTY
 	void pop()
 	{
-	    SMART_ASSERT( !fQ.empty() );
-	    fQ.erase( fQ.begin() );
+	    SMART_ASSERT( !fImpl->empty() );
+	    fImpl->pop();
+	}
+
+	// removes the top entry, and hands it over to e
+	// MUST NOT BE EMPTY
+	void pop( EventInfo& e )
+	{
+	    SMART_ASSERT( !fImpl->empty() );
+	    e.swap( fImpl->top().fEvent );
+	    fImpl->pop();
+	}
+
+	// removes the top entry, and hands it over to e, with its sequence number
+	// MUST NOT BE EMPTY
+	void pop( EventInfo& e, uint64_t& seq )
+	{
+	    SMART_ASSERT( !fImpl->empty() );
+	    seq = fImpl->top().fSeq;
+	    e.swap( fImpl->top().fEvent );
+	    fImpl->pop();
 	}
-	
-	void push( Time when, const EventInfo& e )
+
+	// adds the event, which is taken over (e is left empty)
+	void push( Time when, EventInfo& e )
 	{
-	    fQ.insert( std::make_pair( when, e ) );
+	    fImpl->push( when, fNumEvents, e );
 	    fNumEvents++;
 	}
-	
+
+	// puts a popped event back where it was among the events of the
+	// same time (seq from pop()), for rollbacks
+	void pushAgain( Time when, uint64_t seq, EventInfo& e )
+	{
+	    fImpl->push( when, seq, e );
+	}
+
 	/// To be invoked at simulation wrap-up.
 	/// clears out events from event q
 	void finalize() {
-	  fQ.clear();
+	  fImpl->clear();
 	}
 
 
 	void print( std::ostream& os) const
 	{
-	    os 	<< "EventQueue(size=" << fQ.size() << ", "
+	    os 	<< "EventQueue(" << fImpl->getName() << ", size=" << fImpl->size() << ", "
 		<< "top=";
-	    if( fQ.empty() )
+	    if( fImpl->empty() )
 		os << "EMPTY";
 	    else
-		os << fQ.begin()->first << ": " << fQ.begin()->second;
+		os << fImpl->top().fTime << ": " << fImpl->top().fEvent;
 	    os << ")";
 	}
 
@@ -99,17 +235,22 @@ class EventQueue
   {
     return fNumEvents;
   }
-  
+
+	/// prints how the queue nodes were allocated
+	void printPoolStats( std::ostream& os ) const;
+
 
     protected:
     private:
-    
-	typedef std::multimap< Time, EventInfo > QueueType;
-	
+
 	// the underlying queue implementation
-	QueueType	fQ;
+	EventQueueImpl*	fImpl;
   //unsigned int fNumEvents;
-  uint64_t fNumEvents;
+  uint64_t fNumEvents;	///< also serves as the sequence number of pushed events
+
+	/// unimplemented
+	EventQueue(const EventQueue&);
+	EventQueue& operator=(const EventQueue&);
 };
 
 
@@ -123,6 +264,5 @@ inline std::ostream& operator<<(std::ostream& os, const EventQueue& e)
 
 
 } // namespace
-#endif 
-
+#endif
 
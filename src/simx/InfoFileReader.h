@@ -0,0 +1,126 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    InfoFileReader.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Reads an info file in chunks for InfoManager, optionally ahead
+//     of time in a thread of its own
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_INFOFILEREADER
+#define NISAC_SIMX_INFOFILEREADER
+
+#include "simx/type.h"
+#include "simx/InfoData.h"
+
+#include <boost/shared_ptr.hpp>
+#include <pthread.h>
+
+#include <vector>
+#include <deque>
+
+namespace simx {
+
+class Info;
+class LP;
+class BinaryInfoReader;
+
+/// an info from a file, created and ready to be sent
+struct PreparedInfo
+{
+    Time			fTime;		///< when it is due
+    EntityID			fEntityId;
+    ServiceAddress		fServiceAddress;
+    boost::shared_ptr<Info>	fInfo;
+    LP*				fLp;		///< where the entity lives
+};
+
+/// consecutive infos of a file (only those for this rank), in the order of the file
+struct InfoChunk
+{
+    std::vector<PreparedInfo>	fInfos;
+    bool			fMore;		///< are there more records after the chunk?
+    Time			fNextTime;	///< time of the first of them
+};
+
+/// \class InfoFileReader InfoFileReader.h "simx/InfoFileReader.h"
+///
+/// \brief reads the records of an info file in chunks
+///
+/// A chunk holds about chunkSize records (the infos for other ranks are
+/// read, but left out), so it covers a short time where the file is dense,
+/// and a long one where it is sparse. It never ends between records with
+/// the same time. With prefetching, a thread keeps the next two chunks
+/// read, and the Infos created, while the simulation runs; InfoManager
+/// then only sends them. Otherwise the chunks are read when asked for.
+class InfoFileReader
+{
+    public:
+	/// takes over the reader (text, or binary if binary is not 0)
+	InfoFileReader( InfoData::Reader* text, BinaryInfoReader* binary, size_t chunkSize );
+	/// stops the thread
+	~InfoFileReader();
+
+	/// starts reading ahead in a thread
+	void startPrefetching();
+
+	/// gives the next chunk (waits for the thread if it is not ready yet)
+	void takeChunk( InfoChunk& chunk );
+
+    private:
+	/// reads the next chunk from the file
+	void readChunk( InfoChunk& chunk );
+
+	bool moreRecords() const;
+	Time nextRecordTime() const;
+	/// reads the next record, returns false if it is for another rank
+	bool readRecord( PreparedInfo& info );
+
+	static void* prefetchThread( void* );
+	void prefetch();
+
+	InfoData::Reader*	fText;
+	BinaryInfoReader*	fBinary;
+	const size_t		fChunkSize;
+
+	// prefetching
+	bool			fPrefetching;	///< is the thread running?
+	pthread_t		fThread;
+	pthread_mutex_t		fMutex;
+	pthread_cond_t		fCond;		///< a chunk was read, or taken
+	std::deque<InfoChunk*>	fReady;		///< chunks read ahead, in order
+	std::vector<InfoChunk*>	fFree;		///< chunks to reuse
+	bool			fDone;		///< the thread read the last chunk
+	bool			fStop;		///< the thread is to finish
+
+	static const size_t	kReadAhead = 2;	///< chunks
+
+	/// unimplemented
+	InfoFileReader(const InfoFileReader&);
+	InfoFileReader& operator=(const InfoFileReader&);
+};
+
+} // namespace
+
+#endif
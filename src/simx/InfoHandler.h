@@ -37,6 +37,9 @@
 #include "simx/Info.h"
 #include "simx/logger.h"
 
+#include <typeinfo>
+#include <cstddef>
+
 namespace simx {
 
   class InfoHandler;
@@ -56,6 +59,74 @@ namespace simx {
   };
 
   class Service;
+  template<class InfoClass> class InfoRecipient;
+
+  /// remembers, for each (dynamic) class of Service, where in the object
+  /// its InfoRecipient<InfoClass> base is, or that it has none.
+  /// The cross-cast from Service is then done once per Service class
+  /// instead of on every delivered Info.
+  /// Lookups are lock-free, insertions are serialized by a spinlock.
+  class RecipientCache
+  {
+  public:
+    RecipientCache()
+      :	fNumEntries( 0 ),
+	fLock( 0 )
+    {
+    }
+
+    /// returns false if the class has not been seen yet; otherwise
+    /// isRecipient tells whether it is a recipient, and offset where
+    /// the recipient base is (from the Service base, in bytes)
+    bool find(const std::type_info& serviceType, bool& isRecipient, std::ptrdiff_t& offset) const
+    {
+      const int num = fNumEntries;
+      for( int i = 0; i < num; ++i )
+      {
+	if( *fEntries[i].fType == serviceType )
+	{
+	  isRecipient = fEntries[i].fIsRecipient;
+	  offset = fEntries[i].fOffset;
+	  return true;
+	}
+      }
+      return false;
+    }
+
+    /// remembers the class (does nothing if the cache is full)
+    void insert(const std::type_info& serviceType, bool isRecipient, std::ptrdiff_t offset)
+    {
+      while( __sync_lock_test_and_set( &fLock, 1 ) )
+	;
+      bool dummyRecipient;
+      std::ptrdiff_t dummyOffset;
+      if( fNumEntries < kMaxEntries && !find( serviceType, dummyRecipient, dummyOffset ) )
+      {
+	Entry& entry = fEntries[ fNumEntries ];
+	entry.fType = &serviceType;
+	entry.fIsRecipient = isRecipient;
+	entry.fOffset = offset;
+	__sync_synchronize();	// the entry is complete before it is counted
+	fNumEntries = fNumEntries + 1;
+      }
+      __sync_lock_release( &fLock );
+    }
+
+  private:
+    /// Service classes remembered (a given Info is usually received by few)
+    static const int kMaxEntries = 16;
+
+    struct Entry
+    {
+      const std::type_info*	fType;
+      bool			fIsRecipient;
+      std::ptrdiff_t		fOffset;
+    };
+
+    Entry		fEntries[ kMaxEntries ];
+    volatile int	fNumEntries;	///< entries below this are complete
+    volatile int	fLock;
+  };
 
   /// Base class for all Info handlers 
   class InfoHandler
@@ -65,6 +136,9 @@ namespace simx {
     virtual boost::shared_ptr<Info> create() const = 0;
     virtual boost::shared_ptr<Info> create(const Info&) const = 0;	///< for copy-constructing
     virtual void execute(boost::shared_ptr<Service>, boost::shared_ptr<Info>, bool=true) const = 0;
+    /// the same, on the event delivery path: the Info MUST be of the type
+    /// of this handler (i.e. this is info->getInfoHandler())
+    virtual void execute(Service&, boost::shared_ptr<Info>, bool=true) const = 0;
     //execute an out-of-band info ( controlInfo )
     virtual void executeControl( boost::shared_ptr<Service>, boost::shared_ptr<Info>, bool=true) const = 0;
     virtual Info::ClassType getClassType() const = 0;
@@ -96,6 +170,9 @@ namespace simx {
     /// and an error message is output iff the doError flag is true
     /// If doError flag is false, then it is not an error, only a trial was made
     virtual void execute(boost::shared_ptr<Service> baseService, boost::shared_ptr<Info> baseInfo, bool doError) const;
+    /// the same, but the Info MUST be an InfoClass; the recipient is found
+    /// through the RecipientCache and the Info is not type-checked
+    virtual void execute(Service& baseService, boost::shared_ptr<Info> baseInfo, bool doError) const;
     /// execute an out-of-band info ( controlInfo )
     virtual void executeControl( boost::shared_ptr<Service> baseService, 
 				 boost::shared_ptr<Info> baseInfo, bool doError ) const;
@@ -105,6 +182,12 @@ namespace simx {
 	
     /// returns sizeof(InfoClass)
     virtual size_t getByteSize() const;
+
+  private:
+    /// returns the recipient, or 0 if the service cannot receive InfoClass
+    InfoRecipient<InfoClass>* getRecipient(Service& service) const;
+
+    mutable RecipientCache	fRecipients;
   };
 
   //============================================================================
@@ -40,6 +40,9 @@
 #include "simx/InfoRecipient.h"
 #include "simx/ControlInfoRecipient.h"
 #include "simx/Service.h"
+#include "simx/MemoryPool.h"
+
+#include <boost/make_shared.hpp>
 
 namespace simx {
 
@@ -93,17 +96,68 @@ namespace simx {
   }
 
 
+  // Infos are created on every event: they come from the memory pools,
+  // together with the shared_ptr control block (one block per Info)
   template<class InfoClass>
   boost::shared_ptr<Info> InfoHandlerDerived<InfoClass>::create() const
   {
-    return boost::shared_ptr<Info>( new InfoHandlerWrapper<InfoClass>() );
+    return boost::allocate_shared<InfoHandlerWrapper<InfoClass> >( 
+	PoolAllocator<InfoHandlerWrapper<InfoClass> >() );
   }
 
   template<class InfoClass>
   boost::shared_ptr<Info> InfoHandlerDerived<InfoClass>::create(const Info& source) const
   {
     const InfoClass& src = dynamic_cast<const InfoClass&>(source);
-    return boost::shared_ptr<Info>( new InfoHandlerWrapper<InfoClass>(src) );
+    return boost::allocate_shared<InfoHandlerWrapper<InfoClass> >( 
+	PoolAllocator<InfoHandlerWrapper<InfoClass> >(), src );
+  }
+
+  template<class InfoClass>
+  InfoRecipient<InfoClass>* InfoHandlerDerived<InfoClass>::getRecipient(Service& service) const
+  {
+    const std::type_info& serviceType = typeid(service);
+    bool isRecipient;
+    std::ptrdiff_t offset;
+    if( fRecipients.find( serviceType, isRecipient, offset ) )
+    {
+      if( !isRecipient )
+	return 0;
+      return reinterpret_cast<InfoRecipient<InfoClass>*>( reinterpret_cast<char*>(&service) + offset );
+    }
+
+    // first time this class of Service receives InfoClass: do the cast, remember the result
+    InfoRecipient<InfoClass>* recipient = dynamic_cast<InfoRecipient<InfoClass>*>( &service );
+    offset = recipient ? reinterpret_cast<char*>(recipient) - reinterpret_cast<char*>(&service) : 0;
+    fRecipients.insert( serviceType, recipient != 0, offset );
+    return recipient;
+  }
+
+  template<class InfoClass>
+  void InfoHandlerDerived<InfoClass>::execute(Service& baseService, boost::shared_ptr<Info> baseInfo, bool doError) const
+  {
+    InfoRecipient<InfoClass>* recipient = getRecipient( baseService );
+    if( !recipient )
+    {
+      if( doError )
+      {
+	Logger::warn() << "InfoHandler: invalid recipient, expected " 
+		       << typeid(InfoRecipient<InfoClass>).name() 
+		       << ", received " << typeid(baseService).name() << std::endl;
+      }
+      // else only a trial was made, and it failed
+      return;
+    }
+
+    // the handler comes from the Info itself, so it is an InfoClass
+    SMART_ASSERT( baseInfo );
+#ifdef DEBUG
+    SMART_ASSERT( dynamic_cast<InfoClass*>( baseInfo.get() ) );
+#endif
+    boost::shared_ptr<InfoClass> info = boost::static_pointer_cast<InfoClass>( giveup_smart_ptr(baseInfo) );
+
+    /// we want the receive Arg to be the only Ptr to the Info if possible
+    recipient->receive( giveup_smart_ptr(info) );
   }
 
   template<class InfoClass>
@@ -36,6 +36,7 @@
 #include "simx/control.h"
 #include "simx/type.h"
 #include "simx/InfoData.h"
+#include "simx/InfoFileReader.h"
 #include "simx/InputHandler.h"
 #include "simx/InfoHandler.h"
 #include "simx/logger.h"
@@ -54,6 +55,7 @@ namespace simx {
 
   class LP;
   class InfoHandler;
+  class BinaryInfoReader;
 
 
     /// wakes up manager when time comes to read more input
@@ -112,6 +114,18 @@ namespace simx {
     /// creates an event info from input data
     void createInfoFromInfoData( InfoData& );
 
+    /// creates the Info of an input record (not sent yet), if its destination
+    /// is on this Unix process; returns false otherwise
+    /// (called by the InfoFileReader threads too)
+    bool prepareInfo( Time, const EntityID&, ServiceAddress, Info::ClassType,
+	    ProfileID, Input::DataSource&, PreparedInfo& );
+
+    /// creates an Input from fInputHandler (which the InfoFileReader threads share)
+    boost::shared_ptr<Input> createInput( Info::ClassType, ProfileID, Input::DataSource& );
+
+    /// stops reading the info files (and the threads reading ahead)
+    void closeDataFiles();
+
     /// creates a python event info from python input.
     // TODO (Python) can we make infomanager oblivious to python?
     void createPyInfoFromInfoData( Python::PyInfoData& data );
@@ -148,8 +162,15 @@ namespace simx {
     /// produces Inputs that are Infos created from file
     InputHandler<Info::ClassType>	fInputHandler;
 	
-    typedef std::vector<InfoData::Reader*> FileReaderContainer;
+    typedef std::vector<InfoFileReader*> FileReaderContainer;
     FileReaderContainer 			fFileVector;	///< all info data input files
+    InfoChunk					fChunk;		///< reused by readDataFile
+    pthread_mutex_t				fInputMutex;	///< serializes createInput
+    /// reads only the records for our LPs if INPUT_INDEX is on (see BinaryInputIndex)
+    void useIndex( const std::string& fileName, BinaryInfoReader& reader ) const;
+
+    /// sends an Info created by prepareInfo
+    void sendPreparedInfo( PreparedInfo&, Time now );
 
     Info::ClassType fTypeCounter;		///< counter for automatic Info identification
 
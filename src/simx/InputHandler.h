@@ -54,6 +54,7 @@ class InputHandler
 	template<class InputClass> void registerInput(const ObjectIdent& inputIdent);
     
 	/// Creates an input object, given its Class, ProfileID and Input::DataSource
+	/// (may be called from several threads at once, if the Inputs' readData allows it)
 	boost::shared_ptr<Input> createInput(const ObjectIdent& inputIdent, const ProfileID profileId, Input::DataSource& dataSource);
 	
   
@@ -69,6 +70,10 @@ class InputHandler
 	/// loads profile into (empty) Input structure
 	void loadProfile( const ProfileID profileId, boost::shared_ptr<Input> input );
 
+	/// the Input with the profile read in, to be copied (reads the profile
+	/// the first time); serialized by fProfileLock
+	boost::shared_ptr<Input> getProfileInput( const ObjectIdent& inputIdent, const ProfileID profileId );
+
          /// loads python profile into empty Input structure
   void loadProfile( const ProfileID profileId, const PyProfile& profile, boost::shared_ptr<Input> input);
   
@@ -82,6 +87,7 @@ class InputHandler
 	typedef Loki::AssocVector<std::pair<ObjectIdent, ProfileID>, boost::shared_ptr<Input> >	ProfileMap;
 	/// stores information about profiles that were already read in (in appropriate Input objects)
 	ProfileMap	fProfileMap;
+	volatile int	fProfileLock;	///< guards fProfileMap
 
 	/// object that can create new (empty) Inputs of desired type
 	InputFactory<ObjectIdent>	fInputFactory;
@@ -100,30 +106,48 @@ inline void InputHandler<ObjectIdent>::registerInput(const ObjectIdent& inputIde
 
 template<typename ObjectIdent>
 InputHandler<ObjectIdent>::InputHandler(const std::string& profileSetName)
-    : fProfileSetName( profileSetName )
+    : fProfileSetName( profileSetName ),
+      fProfileLock( 0 )
 {
 }
 
 template<typename ObjectIdent>
-boost::shared_ptr<Input> InputHandler<ObjectIdent>::createInput(const ObjectIdent& inputIdent, const ProfileID profileId, Input::DataSource& dataSource)
+boost::shared_ptr<Input> InputHandler<ObjectIdent>::getProfileInput(const ObjectIdent& inputIdent, const ProfileID profileId)
 {
+    while( __sync_lock_test_and_set( &fProfileLock, 1 ) )
+	while( fProfileLock ) {}
+    try
+    {
+	boost::shared_ptr<Input>& input = fProfileMap[ std::make_pair(inputIdent,profileId) ];
+	if( !input )
+	{
 #ifdef DEBUG
-    Logger::debug3() << "InputHandler: creating Input " << inputIdent << " " << profileId << std::endl;
+	    Logger::debug3() << "InputHandler: loading in new profile" << std::endl;
 #endif
-    boost::shared_ptr<Input>& input = fProfileMap[ std::make_pair(inputIdent,profileId) ];
-    if( !input )
+	    // the Input does not yet have its Profile read in, so do it
+	    input.reset( fInputFactory.CreateObject(inputIdent, input ) );
+	    SMART_ASSERT( input );
+
+	    // read in the profile
+	    loadProfile( profileId, input );
+	}
+	boost::shared_ptr<Input> profileInput( input );
+	__sync_lock_release( &fProfileLock );
+	return profileInput;
+    } catch( ... )
     {
+	__sync_lock_release( &fProfileLock );
+	throw;
+    }
+}
+
+template<typename ObjectIdent>
+boost::shared_ptr<Input> InputHandler<ObjectIdent>::createInput(const ObjectIdent& inputIdent, const ProfileID profileId, Input::DataSource& dataSource)
+{
 #ifdef DEBUG
-      Logger::debug3() << "InputHandler: loading in new profile" << std::endl;
+    Logger::debug3() << "InputHandler: creating Input " << inputIdent << " " << profileId << std::endl;
 #endif
-	// the Input does not yet have its Profile read in, so do it
-	input.reset( fInputFactory.CreateObject(inputIdent, input ) );
-	SMART_ASSERT( input );
-	
-	// read in the profile
-	loadProfile( profileId, input );
-
-    }
+    const boost::shared_ptr<Input> input( getProfileInput( inputIdent, profileId ) );
     
     // make a copy of the Input that already have its profile read in:
     boost::shared_ptr<Input> newInput( fInputFactory.CreateObject(inputIdent, input) );
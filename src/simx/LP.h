@@ -71,12 +71,15 @@ class LP
 	LPID getId() const;
 
 	/// returns associated random stream
+	/// (entities have their own, see Entity::getRandom; this one is not
+	/// for the worker threads, see ky_THREADS_PER_RANK)
 	Random::TRandom& getRandom() const;
   
 	/// return current simulation time.
 	Time getNow() const;
 
 	/// Send an info event to another entity
+	/// (the event is taken over, e must not be used afterwards)
 	void sendEventInfo(EventInfo& e) const;
 
 	/// Sends an event notifying the InfoManager that it should read new chunk of data from input
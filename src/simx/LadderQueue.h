@@ -0,0 +1,111 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+
+//--------------------------------------------------------------------------
+// File:    LadderQueue.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Ladder queue (Tang, Goh, Thng, TOMACS 2005) implementation of EventQueueImpl
+//     (see also minissf/evtlist/ladderq.h)
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_LADDERQUEUE
+#define NISAC_SIMX_LADDERQUEUE
+
+#include "simx/EventQueue.h"
+
+#include <vector>
+
+namespace simx {
+
+/// Ladder queue: far-future events are kept unsorted in Top; when the near
+/// future runs out, Top is bucket-sorted into a rung of the Ladder, and buckets
+/// with too many events are spawned into finer rungs below. Only a small bucket
+/// at a time is actually sorted into Bottom, from which events are dequeued.
+/// push and pop are O(1) amortized, independent of the time distribution.
+class LadderQueue : public EventQueueImpl
+{
+    public:
+	LadderQueue();
+	virtual ~LadderQueue();
+
+	virtual bool empty() const;
+	virtual size_t size() const;
+	virtual EventQueueNode& top();
+	virtual void pop();
+	virtual void push( Time when, uint64_t seq, EventInfo& e );
+	virtual void clear();
+	virtual const char* getName() const;
+	virtual const EventQueueNodePool* getNodePool() const { return &fPool; }
+
+    private:
+	/// one rung of the ladder: buckets of fWidth starting at fStart,
+	/// buckets before fCur have already been consumed
+	struct Rung
+	{
+	    Time			fStart;
+	    Time			fWidth;
+	    size_t			fCur;
+	    std::vector<EventQueueNode*>	fBuckets;	///< unsorted lists
+	    std::vector<size_t>		fCounts;
+
+	    /// start of the first bucket that has not been consumed
+	    Time getCurStart() const { return fStart + Time(fCur)*fWidth; }
+	};
+
+	/// makes a new (lowest) rung for events in [start,end) and moves the
+	/// list of count nodes into it
+	void spawnRung( Time start, Time end, EventQueueNode* list, size_t count );
+	/// adds the node to a bucket of the rung
+	void addToRung( Rung&, EventQueueNode* );
+	/// adds to Bottom, keeping it sorted
+	void addToBottom( EventQueueNode* );
+	/// moves events down the ladder until Bottom is not empty (unless the queue is)
+	void fillBottom();
+
+	/// max number of events in a bucket that is sorted into Bottom directly
+	static const size_t kThreshold = 50;
+	static const size_t kMaxRungs = 8;
+
+	EventQueueNode*		fTop;		///< unsorted list of far-future events
+	size_t			fTopCount;
+	Time			fTopMin;
+	Time			fTopMax;
+	Time			fTopStart;	///< events at or after this go to Top
+
+	std::vector<Rung>	fRungs;		///< kMaxRungs of them, fRungs[0] is the coarsest
+	size_t			fActiveRungs;
+
+	/// sorted in DECREASING order, so that the minimum is popped from the back
+	std::vector<EventQueueNode*>	fBottom;
+
+	size_t			fSize;
+	EventQueueNodePool	fPool;
+
+	/// unimplemented
+	LadderQueue(const LadderQueue&);
+	LadderQueue& operator=(const LadderQueue&);
+};
+
+} // namespace
+#endif
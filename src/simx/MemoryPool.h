@@ -0,0 +1,163 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    MemoryPool.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Fixed-size block pools for the small objects created on every event
+//     (Infos with their shared_ptr control blocks, event queue nodes, ...),
+//     and a std-style allocator on top of them
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_MEMORYPOOL
+#define NISAC_SIMX_MEMORYPOOL
+
+#include "simx/type.h"
+
+#include <vector>
+#include <new>
+#include <iostream>
+
+namespace simx {
+
+/// \class MemoryPool MemoryPool.h "simx/MemoryPool.h"
+///
+/// \brief Pool of equally sized memory blocks.
+///
+/// Blocks are carved out of larger chunks and recycled through a free list;
+/// memory is never given back to the system. Thread-safe (a spinlock, which
+/// is practically never contended: most allocations are done by the main thread).
+class MemoryPool
+{
+    public:
+	explicit MemoryPool( size_t blockSize );
+	~MemoryPool();
+
+	void* allocate();
+	void release( void* );
+
+	size_t getBlockSize() const { return fBlockSize; }
+	/// number of allocate() calls
+	uint64_t getNumAllocations() const { return fNumAllocations; }
+	/// how many of them were served from the free list
+	uint64_t getNumHits() const { return fNumHits; }
+	/// memory taken from the system
+	size_t getNumBytes() const { return fChunks.size() * fChunkSize; }
+
+    private:
+	struct FreeBlock
+	{
+	    FreeBlock*	fNext;
+	};
+
+	void lock()
+	{
+	    while( __sync_lock_test_and_set( &fLock, 1 ) )
+		while( fLock ) {}
+	}
+	void unlock()
+	{
+	    __sync_lock_release( &fLock );
+	}
+
+	const size_t		fBlockSize;
+	const size_t		fChunkSize;	///< bytes allocated at once
+	FreeBlock*		fFree;		///< recycled blocks
+	char*			fNextNew;	///< not yet used part of the last chunk
+	char*			fChunkEnd;
+	std::vector<char*>	fChunks;
+	volatile int		fLock;
+
+	uint64_t		fNumAllocations;
+	uint64_t		fNumHits;
+
+	/// unimplemented
+	MemoryPool(const MemoryPool&);
+	MemoryPool& operator=(const MemoryPool&);
+};
+
+/// largest object size served from the pools, larger go to operator new
+const size_t kMaxPooledSize = 512;
+
+/// returns the pool for objects of the given size (size <= kMaxPooledSize);
+/// sizes are rounded up to multiples of 16 bytes, so that similar objects share pools
+MemoryPool& getMemoryPool( size_t size );
+
+/// allocates from the pools (or operator new for large sizes)
+void* poolAllocate( size_t size );
+/// releases memory from poolAllocate, size must be the same
+void poolRelease( void* p, size_t size );
+
+/// prints usage of the pools that have been used
+void printMemoryPoolStats( std::ostream& os );
+
+
+/// std-style allocator on top of the pools; use with boost::allocate_shared
+/// to get the object and its shared_ptr control block in one pooled block,
+/// or with the node-based std containers
+template<class T>
+class PoolAllocator
+{
+    public:
+	typedef T		value_type;
+	typedef T*		pointer;
+	typedef const T*	const_pointer;
+	typedef T&		reference;
+	typedef const T&	const_reference;
+	typedef size_t		size_type;
+	typedef ptrdiff_t	difference_type;
+
+	template<class U> struct rebind
+	{
+	    typedef PoolAllocator<U> other;
+	};
+
+	PoolAllocator() {}
+	template<class U> PoolAllocator( const PoolAllocator<U>& ) {}
+
+	pointer address( reference x ) const { return &x; }
+	const_pointer address( const_reference x ) const { return &x; }
+
+	pointer allocate( size_type n, const void* = 0 )
+	{
+	    return static_cast<pointer>( poolAllocate( n * sizeof(T) ) );
+	}
+
+	void deallocate( pointer p, size_type n )
+	{
+	    poolRelease( p, n * sizeof(T) );
+	}
+
+	size_type max_size() const { return size_t(-1) / sizeof(T); }
+
+	void construct( pointer p, const T& x ) { new( p ) T( x ); }
+	void destroy( pointer p ) { p->~T(); }
+};
+
+template<class T, class U>
+inline bool operator==( const PoolAllocator<T>&, const PoolAllocator<U>& ) { return true; }
+template<class T, class U>
+inline bool operator!=( const PoolAllocator<T>&, const PoolAllocator<U>& ) { return false; }
+
+} // namespace
+#endif
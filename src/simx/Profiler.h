@@ -0,0 +1,84 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    Profiler.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Execution time of the Infos, per Info type and per Service
+//     (enabled by PROFILE_FILE)
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_PROFILER
+#define NISAC_SIMX_PROFILER
+
+#include "simx/type.h"
+#include "simx/Info.h"
+
+#include <string>
+#include <typeinfo>
+
+namespace simx {
+
+/// \class Profiler Profiler.h "simx/Profiler.h"
+///
+/// \brief records how long the Services take to receive the Infos
+///
+/// When enabled, Entity::processIncomingInfo() times each Info it hands over
+/// to a Service, and records the time under the type of the Info and under
+/// the name of the Service (Python Services included). Each thread records
+/// into its own tables. At the end, the tables of all threads and ranks are
+/// added up, and rank 0 writes the report: count, total, mean and
+/// (approximate) percentiles of the time, per Info type and per Service.
+/// When disabled, the cost is a check of a flag per Info.
+class Profiler
+{
+    public:
+	/// starts recording
+	static void start();
+
+	/// is it recording?
+	static bool isEnabled()
+	{
+	    return fgEnabled;
+	}
+
+	/// a clock for the measurements, in ns
+	static uint64_t now();
+
+	/// records that the Service (of the given name and C++ class) took ns
+	/// to receive an Info of the given type (and C++ class)
+	static void record( Info::ClassType type, const std::type_info& infoClass,
+	    const ServiceName& serviceName, const std::type_info& serviceClass, uint64_t ns );
+
+	/// adds up what all threads and ranks recorded, and writes the report
+	/// to fileName (on rank 0)
+	/// COLLECTIVE
+	static void writeReport( const std::string& fileName );
+
+    private:
+	static bool fgEnabled;
+};
+
+} // namespace
+
+#endif
@@ -64,6 +64,9 @@ namespace simx {
       boost::python::object& getPyObj();
       void createPyServices( const PyEntityInput& input );
       virtual ~PyEntity() {}
+
+      /// Python code only runs in the main thread (which holds the GIL)
+      virtual bool needsMainThread() const { return true; }
       int i;
 
       // function to execute call-backs in python
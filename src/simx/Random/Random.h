@@ -74,6 +74,11 @@ namespace Random {
     ///  Construct a random number stream.  The id must be in
     ///  [0,fgStreams-1].
     TRandom(int id);
+
+    ///  Construct a random number stream for a key of two parts (e.g.
+    ///  the type and number of an entity ID) instead of a stream id.
+    ///  Different keys give different streams, any number of them.
+    TRandom(int kind, long number);
  
     ///  Destroy a random number stream.
     ~TRandom();
@@ -137,6 +142,19 @@ namespace Random {
     /// (see http://www.itl.nist.gov/div898/handbook/eda/section3/eda3663.htm)
     double GetCauchy(float s, float t);
 
+    ///  State of the stream (see GetState).
+    struct State
+    {
+      unsigned short fStream[3];
+    };
+
+    ///  Return the state of the stream, so that it can be set back
+    ///  with SetState (e.g. when an event is rolled back).
+    State GetState() const;
+
+    ///  Set the stream back to a state returned by GetState.
+    void SetState(const State& state);
+
     ///  Define the number of random streams.  A value < 1 will be
     ///  reset to 1.
     static void SetNumberStreams(int nstreams);
@@ -167,10 +185,10 @@ namespace Random {
 
   private:
 
-    // Copy constructor and assignment operator are private and
-    // undefined to avoid problems due to sharing pointers.
-    TRandom(const TRandom& random);
-    TRandom& operator=(const TRandom& random);
+    // The copy constructor and assignment operator are the implicit
+    // ones: the state is all in fStream (no SPRNG pointers are shared
+    // any more), a copy continues the same sequence on its own. Entities
+    // hold a stream each, and are copied by the Python bindings.
  
     //  The random stream id.
     int fId;
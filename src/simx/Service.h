@@ -36,6 +36,7 @@
 #include "simx/Entity.h"
 #include "simx/InfoRecipient.h"
 #include "simx/Input.h"
+#include "simx/StateSaving.h"
 
 #include <iosfwd>
 
@@ -105,6 +106,35 @@ class Service
 	/// debug printing
 	virtual void print(std::ostream&) const;
 
+	/// how the service is rolled back in optimistic runs (SYNC_MODE = optimistic)
+	enum eStateSaving {
+	    kStateSavingNone,		///< cannot be rolled back (events for its entity wait until they are safe)
+	    kStateSavingCopy,		///< saveState() before each event, restoreState() to roll it back
+	    kStateSavingIncremental	///< the service calls saveValue() before it changes anything
+	};
+
+	/// returns how the service saves its state, kStateSavingNone by default
+	/// (a service without state can return kStateSavingIncremental)
+	virtual eStateSaving getStateSaving() const;
+
+	/// for kStateSavingCopy: returns a copy of the state of the service
+	virtual boost::shared_ptr<SavedState> saveState() const;
+
+	/// for kStateSavingCopy: sets the state back to what saveState() returned
+	virtual void restoreState(const SavedState&);
+
+    protected:
+	/// for kStateSavingIncremental: to be called with a member of the service
+	/// before an event changes it, so that the change can be undone;
+	/// does nothing in conservative runs
+	template<typename T>
+	void saveValue(T& value) const
+	{
+	    UndoLog* log = UndoLog::getCurrent();
+	    if( log )
+		log->save( value );
+	}
+
     private:
 	//const ServiceName&	fName;		///< not necessary, but handy for output (reference because it might be a large type)
 	const ServiceName fName; 
@@ -0,0 +1,149 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    ShmTransport.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Shared memory transport for messages between ranks on the same node
+//     SimEngine writes its event buffers for node-local ranks into
+//     single-producer single-consumer rings in an MPI-3 shared memory
+//     window instead of sending them with MPI
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_SHMTRANSPORT
+#define NISAC_SIMX_SHMTRANSPORT
+
+#ifdef HAVE_MPI_H
+
+#include "mpi.h"
+
+#include "simx/type.h"
+
+#include <vector>
+
+namespace simx {
+
+/// \class ShmTransport ShmTransport.h "simx/ShmTransport.h"
+///
+/// \brief rings in shared memory between the ranks of one node
+///
+/// Every rank owns one ring for each other rank on its node, into which only
+/// that rank writes (send()), and only the owner reads (poll()). A message
+/// is stored as [int size][bytes], possibly wrapping around the end of the
+/// ring. The write and read positions only grow, each is written by one side.
+/// send() fails if the ring has no room for the message, the caller then
+/// sends it some other way.
+class ShmTransport
+{
+    public:
+	/// called by poll() for each message; the memory is valid only
+	/// during the call
+	typedef void (*Handler)( char* data, int size );
+
+	ShmTransport();
+	~ShmTransport();
+
+	/// finds the ranks of comm on this node, and sets up rings of
+	/// ringSize bytes with each of them (nothing if ringSize is 0)
+	/// COLLECTIVE over comm
+	void init( MPI_Comm comm, size_t ringSize );
+
+	/// frees the rings, they must be empty
+	/// COLLECTIVE over the comm given to init()
+	void finalize();
+
+	/// is there a ring to this rank?
+	bool isLocal( int rank ) const
+	{
+	    return rank >= 0 && (size_t)rank < fOut.size() && fOut[rank].fData;
+	}
+
+	/// are there any rings at all?
+	bool isActive() const
+	{
+	    return fWindow != MPI_WIN_NULL;
+	}
+
+	/// writes a message into the ring to destRank, returns false if there is
+	/// no ring to it, or not enough room in it
+	/// ONLY ONE THREAD AT A TIME MAY CALL THIS FOR THE SAME destRank
+	bool send( int destRank, const char* data, int size );
+
+	/// hands the messages waiting in all our rings to handler,
+	/// returns how many there were
+	/// ONLY ONE THREAD MAY CALL THIS
+	int poll( Handler handler );
+
+	/// number of other ranks on this node
+	int getNumLocalRanks() const { return fNumLocal; }
+
+	// stats
+	uint64_t getNumSent() const { return fNumSent; }
+	uint64_t getBytesSent() const { return fBytesSent; }
+	uint64_t getNumFull() const { return fNumFull; }
+
+    private:
+	/// the positions, on separate cache lines
+	struct RingHeader
+	{
+	    volatile uint64_t	fRead;		///< bytes read so far (by the owner)
+	    char		fPad1[56];
+	    volatile uint64_t	fWritten;	///< bytes written so far (by the sender)
+	    char		fPad2[56];
+	};
+
+	struct Ring
+	{
+	    RingHeader*	fHeader;
+	    char*	fData;
+	};
+
+	/// the index-th ring in the window memory of a rank
+	Ring ringAt( char* base, int index ) const;
+
+	/// copies between the ring and contiguous memory, wrapping around
+	void copyIn( const Ring& ring, uint64_t pos, const char* data, size_t size ) const;
+	void copyOut( const Ring& ring, uint64_t pos, char* data, size_t size ) const;
+
+	MPI_Win			fWindow;	///< the shared memory
+	MPI_Comm		fNodeComm;	///< the ranks on this node
+	size_t			fRingSize;	///< bytes of data in each ring
+	int			fNumLocal;
+
+	std::vector<Ring>	fOut;		///< ring to each rank (fData is 0 if none)
+	std::vector<Ring>	fIn;		///< our rings, one from each other rank on the node
+	std::vector<char>	fScratch;	///< for messages wrapping around
+
+	uint64_t		fNumSent;
+	uint64_t		fBytesSent;
+	uint64_t		fNumFull;	///< sends that did not fit
+
+	/// unimplemented
+	ShmTransport(const ShmTransport&);
+	ShmTransport& operator=(const ShmTransport&);
+};
+
+} // namespace
+
+#endif // HAVE_MPI_H
+#endif
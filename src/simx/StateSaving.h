@@ -0,0 +1,134 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+
+//--------------------------------------------------------------------------
+// File:    StateSaving.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//	State saving for optimistic execution (SYNC_MODE = optimistic):
+//	saved copies of Entity/Service state, and the undo log
+//	for incremental state saving
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_STATESAVING
+#define NISAC_SIMX_STATESAVING
+
+#include "simx/MemoryPool.h"
+
+#include "boost/shared_ptr.hpp"
+
+#include <vector>
+
+namespace simx {
+
+/// \class SavedState StateSaving.h "simx/StateSaving.h"
+///
+/// \brief State of a Service (or Entity) saved before an event is executed
+/// optimistically, to roll the event back (see Service::saveState).
+class SavedState
+{
+    public:
+	virtual ~SavedState();
+};
+
+/// the states saved for one event, in the order saved
+typedef std::vector<boost::shared_ptr<SavedState> > SavedStates;
+
+/// SavedState that is a copy of a value
+/// (e.g. a struct holding all the state of a service)
+template<typename T>
+class SavedCopy : public SavedState
+{
+    public:
+	explicit SavedCopy(const T& value) : fValue( value ) {}
+	const T& get() const { return fValue; }
+    private:
+	T	fValue;
+};
+
+/// \class UndoLog StateSaving.h "simx/StateSaving.h"
+///
+/// \brief Incremental state saving: old values of whatever an event changes.
+///
+/// The engine makes the log of the event being executed current, and
+/// Service::saveValue() records into it. Undoing the log restores
+/// the values, the most recently saved first.
+class UndoLog
+{
+    public:
+	UndoLog();
+	~UndoLog();
+
+	/// records the current value of 'value' (which must live until the log is cleared)
+	template<typename T>
+	void save(T& value)
+	{
+	    void* mem = poolAllocate( sizeof(ValueRecord<T>) );
+	    fRecords.push_back( new( mem ) ValueRecord<T>( value ) );
+	}
+
+	/// restores all the saved values, and clears the log
+	void undo();
+	/// forgets the saved values
+	void clear();
+	bool empty() const { return fRecords.empty(); }
+
+	/// the log of the event being executed, 0 if there is none
+	/// (conservative runs, or outside of event execution)
+	static UndoLog* getCurrent() { return fgCurrent; }
+	static void setCurrent(UndoLog* log) { fgCurrent = log; }
+
+    private:
+	struct Record
+	{
+	    virtual ~Record() {}
+	    virtual void undo() = 0;
+	    /// destructs the record and gives its memory back to the pool
+	    virtual void destroy() = 0;
+	};
+
+	template<typename T>
+	struct ValueRecord : public Record
+	{
+	    explicit ValueRecord(T& value) : fPtr( &value ), fOld( value ) {}
+	    virtual void undo() { *fPtr = fOld; }
+	    virtual void destroy()
+	    {
+		this->~ValueRecord();
+		poolRelease( this, sizeof(ValueRecord<T>) );
+	    }
+	    T*	fPtr;
+	    T	fOld;
+	};
+
+	std::vector<Record*>	fRecords;
+
+	static UndoLog*		fgCurrent;
+
+	/// unimplemented
+	UndoLog(const UndoLog&);
+	UndoLog& operator=(const UndoLog&);
+};
+
+} // namespace
+#endif
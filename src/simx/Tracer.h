@@ -0,0 +1,105 @@
+// Copyright (c) 2012. Los Alamos National Security, LLC. 
+
+// This material was produced under U.S. Government contract DE-AC52-06NA25396
+// for Los Alamos National Laboratory (LANL), which is operated by Los Alamos 
+// National Security, LLC for the U.S. Department of Energy. The U.S. Government 
+// has rights to use, reproduce, and distribute this software.  
+
+// NEITHER THE GOVERNMENT NOR LOS ALAMOS NATIONAL SECURITY, LLC MAKES ANY WARRANTY, 
+// EXPRESS OR IMPLIED, OR ASSUMES ANY LIABILITY FOR THE USE OF THIS SOFTWARE.  
+// If software is modified to produce derivative works, such modified software should
+// be clearly marked, so as not to confuse it with the version available from LANL.
+
+// Additionally, this library is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License v 2.1 as published by the 
+// Free Software Foundation. Accordingly, this library is distributed in the hope that 
+// it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of 
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See LICENSE.txt for more details.
+//--------------------------------------------------------------------------
+// File:    Tracer.h
+// Module:  simx
+// Created: Oct 17 2026
+//
+// Description:
+//     Timeline of what SimEngine spends its time on, per rank and thread,
+//     written as a Chrome trace (enabled by TRACE_FILE)
+//
+// @@
+//
+//--------------------------------------------------------------------------
+
+#ifndef NISAC_SIMX_TRACER
+#define NISAC_SIMX_TRACER
+
+#include "simx/type.h"
+
+#include <string>
+
+namespace simx {
+
+/// \class Tracer Tracer.h "simx/Tracer.h"
+///
+/// \brief records the phases of SimEngine as spans of wall clock time
+///
+/// Each thread records into its own buffer of fixed size; a full buffer is
+/// appended to the binary log of the rank (TRACE_FILE.<rank>.bin), so the
+/// memory used stays bounded however long the run is. At the end, rank 0
+/// merges the logs of all ranks (they must be visible to it) into one
+/// Chrome trace (TRACE_FILE), which chrome://tracing and Perfetto open:
+/// a process per rank, a thread per worker and one for the listening thread.
+/// When disabled, the cost is a check of a flag at each place that records.
+class Tracer
+{
+    public:
+	/// what a span is
+	enum Kind {
+	    kExecute,		///< a worker executing a window (arg: events)
+	    kSync,		///< the main thread syncing with the other ranks
+	    kReduce,		///< in a collective MPI call
+	    kWaitEvents,	///< waiting for the events sent to us in a window
+	    kSend,		///< sending a buffer of events (arg: bytes)
+	    kReceive,		///< unpacking a received buffer of events (arg: bytes)
+	    kEvent,		///< executing an event (sampled; arg: its time)
+	    kGvt,		///< computing GVT (optimistic mode)
+	    kRollback,		///< rolling back (arg: events rolled back)
+	    kFlush,		///< writing the trace buffer out
+	    kNumKinds
+	};
+
+	/// the thread id of the listening thread (workers are 0, 1, ...)
+	static const int kListeningThread = 1000;
+
+	/// starts recording (to fileName.<rank>.bin), each thread buffers
+	/// bufferSize spans, and every sampleEvery-th event is recorded (none if 0)
+	static void start( const std::string& fileName, int sampleEvery, size_t bufferSize );
+
+	/// is it recording?
+	static bool isEnabled()
+	{
+	    return fgEnabled;
+	}
+
+	/// sets the thread id of the calling thread (0 by default)
+	static void setThread( int id );
+
+	/// wall clock, in ns
+	static uint64_t now();
+
+	/// records a span from start until now
+	static void record( Kind kind, uint64_t start, uint64_t arg = 0 );
+
+	/// should this event execution be recorded?
+	static bool sampleEvent();
+
+	/// writes out the buffers, and merges the logs of all ranks into
+	/// the trace (on rank 0)
+	/// COLLECTIVE
+	static void finish();
+
+    private:
+	static bool fgEnabled;
+};
+
+} // namespace
+
+#endif
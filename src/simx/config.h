@@ -43,8 +43,10 @@ static const std::string ky_OUTPUT_FILE = "OUTPUT_FILE";
 
 static const std::string ky_SERVICE_FILES = "SERVICE_FILES";
 
+/// text files, or binary ones written by simx_convert_input (see BinaryInput.h)
 static const std::string ky_ENTITY_FILES = "ENTITY_FILES";
 
+/// text files, or binary ones written by simx_convert_input (see BinaryInput.h)
 static const std::string ky_INFO_FILES = "INFO_FILES";
 
 
@@ -77,6 +79,90 @@ static const std::string ky_CONTROLLER_INPUT = "CONTROLLER_INPUT";
 
 /// [11/19/2008 by Guanhua Yan]
 static const std::string ky_CONTROLLER_OUTPUT = "CONTROLLER_OUTPUT";
+
+/// which priority queue SimEngine uses: multimap (default), calendar or ladder
+static const std::string ky_EVENT_QUEUE = "EVENT_QUEUE";
+
+/// remote events are aggregated per destination rank; a buffer is sent out
+/// once it holds this many bytes (and at the end of each sync window anyway)
+static const std::string ky_SEND_BUFFER_SIZE = "SEND_BUFFER_SIZE";
+
+/// size in bytes of the shared memory ring to each other rank on the same
+/// node (default 1048576), which the buffers for it go through while they
+/// fit; 0 sends everything with MPI
+static const std::string ky_SHM_RING_SIZE = "SHM_RING_SIZE";
+
+/// how SimEngine picks its sync windows: fixed (MINDELAY wide, default) or
+/// adaptive (per-rank windows from the next event times of the other ranks)
+static const std::string ky_SYNC_WINDOW = "SYNC_WINDOW";
+
+/// how SimEngine synchronizes the ranks: conservative (default) or optimistic
+/// (Time Warp: ranks run ahead, and roll back events that turn out too early)
+static const std::string ky_SYNC_MODE = "SYNC_MODE";
+
+/// optimistic mode: how many events each rank executes between GVT computations
+static const std::string ky_GVT_INTERVAL = "GVT_INTERVAL";
+
+/// number of threads executing events on each rank (default 1), each one
+/// owns part of the rank's entities (conservative mode only); with more
+/// than one, no entities can be created once the simulation runs. The
+/// results do not depend on it (each entity has its own random stream),
+/// the output only orders what is written at the same time differently
+static const std::string ky_THREADS_PER_RANK = "THREADS_PER_RANK";
+
+/// file with fixed entity placement, lines of "EntityID LPID", e.g. "(p 112) 3"
+/// (entities not listed are placed by the placing functions)
+static const std::string ky_PLACEMENT_FILE = "PLACEMENT_FILE";
+
+/// entity graph file(s) (see EntityGraph), partitioned with METIS at start-up
+/// to place the entities in it (overrides PLACEMENT_FILE for those entities);
+/// needs a build with METIS (-DSIMX_USE_METIS=1, or the SSF build)
+static const std::string ky_PARTITION_GRAPH = "PARTITION_GRAPH";
+
+/// if set, the traffic between entities is recorded and written (with the
+/// entity weights) to this file + rank suffix, usable as PARTITION_GRAPH
+static const std::string ky_TRAFFIC_GRAPH_FILE = "TRAFFIC_GRAPH_FILE";
+
+/// if set, the time the Services take to receive the Infos is recorded (per
+/// Info type and per Service), and the report of all ranks written to this file
+static const std::string ky_PROFILE_FILE = "PROFILE_FILE";
+
+/// if set, a timeline of the engine (execution, syncing, sends and receives
+/// per rank and thread) is written to this file as a Chrome trace
+static const std::string ky_TRACE_FILE = "TRACE_FILE";
+
+/// tracing: every how many-th event execution is recorded (default 1000, 0 none)
+static const std::string ky_TRACE_SAMPLE = "TRACE_SAMPLE";
+
+/// tracing: spans each thread buffers before writing them out (default 65536)
+static const std::string ky_TRACE_BUFFER = "TRACE_BUFFER";
+
+/// if set, each rank writes a line per sync window (events executed, busy and
+/// sync time, messages sent and received) to this file + rank suffix
+static const std::string ky_LOAD_FILE = "LOAD_FILE";
+
+/// on: each rank reads only the records of its own LPs from the binary
+/// entity and info files, using the index next to each file (see
+/// BinaryInputIndex), which is made when missing or out of date
+static const std::string ky_INPUT_INDEX = "INPUT_INDEX";
+
+/// about how many records of an info file are read at a time (default 10000)
+static const std::string ky_INFO_CHUNK_SIZE = "INFO_CHUNK_SIZE";
+
+/// on: the info files are read ahead in a thread per file (default off),
+/// the Inputs of the Infos must then be readable in any thread
+static const std::string ky_INFO_PREFETCH = "INFO_PREFETCH";
+
+/// threads reading the entities of the entity files (default 1), see
+/// EntityLoader; the Inputs of the entities must then be readable in any
+/// thread, and the placing functions must not look up entities
+static const std::string ky_ENTITY_THREADS = "ENTITY_THREADS";
+
+/// on: with ENTITY_THREADS > 1, the entities (and their services) are also
+/// constructed in those threads (default off: in the main thread); their
+/// constructors must then work in any thread, e.g. not use the random
+/// streams (but the entity's own), the output or the InfoManager
+static const std::string ky_ENTITY_PARALLEL_CREATE = "ENTITY_PARALLEL_CREATE";
 } // namespace
 
 #endif 
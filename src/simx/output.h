@@ -47,11 +47,23 @@ namespace Output
     struct OutputStream 
     {
 	~OutputStream();
+	/// where the output of the calling thread goes now
+	std::ostream& get() { return fgRedirect ? *fgRedirect : fStream; }
 	std::ofstream fStream; 
+	static __thread std::ostream* fgRedirect;	///< see redirect()
     };
 	
     /// initializaton function
     void init(const std::string& fileName);
+
+    /// sends the output of the calling thread to os instead of the file
+    /// (until redirect(0)), the engine writes it with commit() later: once
+    /// the event that made it cannot be rolled back anymore (optimistic
+    /// execution), or at the end of the window (worker threads)
+    void redirect(std::ostream* os);
+
+    /// writes output (collected by redirect()) to the file
+    void commit(const std::string& text);
 	
     /// returns an OutputStream object that can be used for outputtting things
     OutputStream& output(const Entity&, const OutputRecordType, Control::eSimPhase = Control::kPhaseRun );
@@ -63,8 +75,8 @@ namespace Output
     template<class Type>
     Output::OutputStream& operator<<(Output::OutputStream& os, const Type& obj)
     {
-	os.fStream << "\t";
-	os.fStream << obj;
+	os.get() << "\t";
+	os.get() << obj;
 	return os;
     }
     
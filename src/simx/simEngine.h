@@ -47,6 +47,8 @@
 
 namespace simx {
 
+class Entity;
+
 namespace SimEngine {
 
 //=======================================================
@@ -80,7 +82,46 @@ void finalize();
 Time getNow();
 
 // packs an event, and sends it off
-void sendEventInfo( LPID destLP, const simx::EventInfo& e );
+// the event is taken over: e must not be used afterwards
+void sendEventInfo( LPID destLP, simx::EventInfo& e );
+
+// number of worker threads executing events on this rank (THREADS_PER_RANK)
+int getNumWorkers();
+
+// whether run() is executing (with several workers, they and the listening
+// thread then look up entities concurrently, see EntityManager::addEntity)
+bool isRunning();
+
+// the worker the calling thread is (0 is the main thread, and any thread
+// that is not a worker)
+int getWorker();
+
+// picks the worker for a new entity on this rank
+int assignWorker( const Entity& entity );
+
+// what the engine did on this rank (the numbers finalize() logs)
+struct Stats
+{
+    uint64_t	fEventsScheduled;	//< events pushed (minus rolled back and cancelled ones)
+    uint64_t	fEventsExecuted;	//< (committed ones in the optimistic mode)
+    uint64_t	fRemoteEvents;		//< events sent to other ranks
+    uint64_t	fMessagesSent;		//< messages they went in, by any transport
+    uint64_t	fBytesSent;
+    uint64_t	fShmMessagesSent;	//< those of them that went through shared memory
+    uint64_t	fShmBytesSent;
+    uint64_t	fSyncWindows;		//< conservative sync windows
+    uint64_t	fGvtRounds;		//< optimistic GVT computations
+    uint64_t	fReductions;		//< collective calls for syncing
+    uint64_t	fRollbacks;
+    uint64_t	fEventsRolledBack;
+    uint64_t	fEventsReceived;	//< events received from other ranks
+    double	fRunTime;		//< wall clock seconds in run()
+    double	fBusyTime;		//< of it, the main thread executing events
+    double	fSyncTime;		//< and syncing with the others (and waiting for them)
+};
+
+// returns the stats of this rank (complete after run())
+Stats getStats();
 
 
 } // namespace SimEngine
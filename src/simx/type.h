@@ -104,8 +104,8 @@ namespace simx {
 template<typename T>
 boost::shared_ptr<T> giveup_smart_ptr(boost::shared_ptr<T>& in)
 {
-    boost::shared_ptr<T> tmp(in);
-    in.reset();
+    boost::shared_ptr<T> tmp;
+    tmp.swap( in );	///< no reference count updates
     return tmp;
 }
 